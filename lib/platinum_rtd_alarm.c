@@ -0,0 +1,204 @@
+/**
+ * @file    platinum_rtd_alarm.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Resistance-domain alarm evaluation for platinum RTD channels.
+ *
+ * @details
+ * This file implements the per-channel alarm limit tables and the branch-free frame evaluation
+ * declared in @c platinum_rtd_alarm.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_alarm.h"    ///< Header file for RTD alarm functions.
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes an alarm table with all limits disabled and no active alarm.
+ *
+ * @param[out] table          Alarm table to initialize.
+ * @param[in]  high_set       Storage for @p channel_count high set points.
+ * @param[in]  high_clear     Storage for @p channel_count high clear points.
+ * @param[in]  low_set        Storage for @p channel_count low set points.
+ * @param[in]  low_clear      Storage for @p channel_count low clear points.
+ * @param[in]  state          Storage for @p channel_count state flags.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Alarm_Init(RTD_AlarmTable_t *table, double *high_set, double *high_clear, double *low_set, double *low_clear,
+                       uint8_t *state, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+
+    if ( (table != NULL) && (high_set != NULL) && (high_clear != NULL) && (low_set != NULL) && (low_clear != NULL) && (state != NULL) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            high_set[channel] = HUGE_VAL;
+            high_clear[channel] = HUGE_VAL;
+            low_set[channel] = -HUGE_VAL;
+            low_clear[channel] = -HUGE_VAL;
+            state[channel] = RTD_ALARM_NONE;
+        }
+
+        table->high_set = high_set;
+        table->high_clear = high_clear;
+        table->low_set = low_set;
+        table->low_clear = low_clear;
+        table->state = state;
+        table->channel_count = channel_count;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Sets the high alarm limit of a channel.
+ *
+ * @details
+ * The limit and the clear point (@p temperature - @p hysteresis) are converted to resistance
+ * with @c RTD_CalculateResistance.
+ *
+ * @param[in,out] table        Alarm table.
+ * @param[in]     channel      Channel number.
+ * @param[in]     sensor_type  The RTD sensor type of the channel.
+ * @param[in]     temperature  High limit in degrees Celsius.
+ * @param[in]     hysteresis   Hysteresis in kelvin (>= 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid (the limit is left unchanged).
+ */
+uint8_t RTD_Alarm_SetHighLimit(RTD_AlarmTable_t *table, uint32_t channel, uint16_t sensor_type, double temperature, double hysteresis)
+{
+    uint8_t is_valid = 0U;
+    double set_resistance = RTD_CONVERSION_FAILED, clear_resistance = RTD_CONVERSION_FAILED;
+
+    if ( (table != NULL) && (channel < table->channel_count) && (hysteresis >= 0.0) )
+    {
+        set_resistance = RTD_CalculateResistance(sensor_type, temperature);
+        clear_resistance = RTD_CalculateResistance(sensor_type, temperature - hysteresis);
+
+        if ( (set_resistance != RTD_CONVERSION_FAILED) && (clear_resistance != RTD_CONVERSION_FAILED) )
+        {
+            table->high_set[channel] = set_resistance;
+            table->high_clear[channel] = clear_resistance;
+            is_valid = 1U;
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Sets the low alarm limit of a channel.
+ *
+ * @details
+ * The limit and the clear point (@p temperature + @p hysteresis) are converted to resistance
+ * with @c RTD_CalculateResistance.
+ *
+ * @param[in,out] table        Alarm table.
+ * @param[in]     channel      Channel number.
+ * @param[in]     sensor_type  The RTD sensor type of the channel.
+ * @param[in]     temperature  Low limit in degrees Celsius.
+ * @param[in]     hysteresis   Hysteresis in kelvin (>= 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid (the limit is left unchanged).
+ */
+uint8_t RTD_Alarm_SetLowLimit(RTD_AlarmTable_t *table, uint32_t channel, uint16_t sensor_type, double temperature, double hysteresis)
+{
+    uint8_t is_valid = 0U;
+    double set_resistance = RTD_CONVERSION_FAILED, clear_resistance = RTD_CONVERSION_FAILED;
+
+    if ( (table != NULL) && (channel < table->channel_count) && (hysteresis >= 0.0) )
+    {
+        set_resistance = RTD_CalculateResistance(sensor_type, temperature);
+        clear_resistance = RTD_CalculateResistance(sensor_type, temperature + hysteresis);
+
+        if ( (set_resistance != RTD_CONVERSION_FAILED) && (clear_resistance != RTD_CONVERSION_FAILED) )
+        {
+            table->low_set[channel] = set_resistance;
+            table->low_clear[channel] = clear_resistance;
+            is_valid = 1U;
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Evaluates one frame of raw resistances against the alarm limits.
+ *
+ * @details
+ * Element i of @p resistances belongs to channel i. The state of every channel is updated with
+ * hysteresis using only resistance compares; no temperature conversion is performed.
+ *
+ * @param[in,out] table        Alarm table.
+ * @param[in]     resistances  Measured resistances in ohms, one per channel.
+ * @param[out]    alarm_mask   Optional bit mask receiving bit i set for every channel in alarm,
+ *                             ((channel_count + 31) / 32 words), suitable as the mask argument of
+ *                             @c RTD_CalculateTemperatureStrided. Pass @c NULL if not needed.
+ *
+ * @return Number of channels in alarm.
+ */
+uint32_t RTD_Alarm_Evaluate(RTD_AlarmTable_t *table, const double *resistances, uint32_t *alarm_mask)
+{
+    uint32_t channel = 0U, alarmed = 0U, channel_count = 0U;
+    uint8_t high = 0U, low = 0U, previous = 0U;
+    double resistance = 0.0, high_limit = 0.0, low_limit = 0.0;
+    const double *high_set = NULL, *high_clear = NULL, *low_set = NULL, *low_clear = NULL;
+    uint8_t *state = NULL;
+
+    if ( (table != NULL) && (resistances != NULL) )
+    {
+        /* Local copies: stores to the byte-sized states must not force the limits to be reloaded */
+        high_set = table->high_set;
+        high_clear = table->high_clear;
+        low_set = table->low_set;
+        low_clear = table->low_clear;
+        state = table->state;
+        channel_count = table->channel_count;
+
+        /* Branch-free state update: an active alarm is compared against its clear point instead of its set point */
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            resistance = resistances[channel];
+            previous = state[channel];
+            high_limit = ((previous & RTD_ALARM_HIGH) != 0U) ? high_clear[channel] : high_set[channel];
+            low_limit = ((previous & RTD_ALARM_LOW) != 0U) ? low_clear[channel] : low_set[channel];
+            high = (resistance > high_limit) ? 1U : 0U;
+            low = (resistance < low_limit) ? 1U : 0U;
+            state[channel] = (uint8_t)(high | (uint8_t)(low << 1U));
+            alarmed += (uint32_t)(high | low);
+        }
+
+        if (alarm_mask != NULL)
+        {
+            for (channel = 0U; channel < channel_count; channel++)
+            {
+                if ((channel & 31U) == 0U)
+                {
+                    alarm_mask[channel >> 5U] = 0U;
+                }
+
+                alarm_mask[channel >> 5U] |= (uint32_t)(state[channel] != RTD_ALARM_NONE) << (channel & 31U);
+            }
+        }
+    }
+
+    return alarmed;
+}
+
+
+/* platinum_rtd_alarm.c */
@@ -0,0 +1,143 @@
+/**
+ * @file    platinum_rtd_alarm.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Resistance-domain alarm evaluation for platinum RTD channels.
+ *
+ * @details
+ * Because the Callendar–Van Dusen relationship is strictly increasing over -200°C to +850°C,
+ * a temperature threshold is equivalent to a resistance threshold. This file converts per-channel
+ * high/low alarm limits and their hysteresis to resistance once, with @c RTD_CalculateResistance,
+ * and then evaluates raw resistance frames with branch-free compares that compilers vectorize.
+ * Only channels that are in alarm need an exact inverse conversion; @c RTD_Alarm_Evaluate can
+ * emit a bit mask for @c RTD_CalculateTemperatureStrided for that purpose.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_ALARM_H
+#define _PLATINUM_RTD_ALARM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @name Alarm State Flags
+ *  @{
+ */
+#define  RTD_ALARM_NONE  0x00U    /**< Channel within limits     */
+#define  RTD_ALARM_HIGH  0x01U    /**< High alarm active         */
+#define  RTD_ALARM_LOW   0x02U    /**< Low alarm active          */
+/** @} */
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Per-channel alarm limits in the resistance domain (structure-of-arrays).
+ *
+ * @details
+ * A high alarm is raised when R > @c high_set and cleared when R <= @c high_clear; a low alarm
+ * is raised when R < @c low_set and cleared when R >= @c low_clear. All arrays are provided by
+ * the caller and hold @c channel_count elements.
+ */
+typedef struct
+{
+    double *high_set;          /**< Resistance raising the high alarm (ohms)   */
+    double *high_clear;        /**< Resistance clearing the high alarm (ohms)  */
+    double *low_set;           /**< Resistance raising the low alarm (ohms)    */
+    double *low_clear;         /**< Resistance clearing the low alarm (ohms)   */
+    uint8_t *state;            /**< Alarm state flags (@c RTD_ALARM_x)         */
+    uint32_t channel_count;    /**< Number of channels                         */
+} RTD_AlarmTable_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes an alarm table with all limits disabled and no active alarm.
+ *
+ * @param[out] table          Alarm table to initialize.
+ * @param[in]  high_set       Storage for @p channel_count high set points.
+ * @param[in]  high_clear     Storage for @p channel_count high clear points.
+ * @param[in]  low_set        Storage for @p channel_count low set points.
+ * @param[in]  low_clear      Storage for @p channel_count low clear points.
+ * @param[in]  state          Storage for @p channel_count state flags.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Alarm_Init(RTD_AlarmTable_t *table, double *high_set, double *high_clear, double *low_set, double *low_clear,
+                       uint8_t *state, uint32_t channel_count);
+
+/**
+ * @brief Sets the high alarm limit of a channel.
+ *
+ * @details
+ * The limit and the clear point (@p temperature - @p hysteresis) are converted to resistance
+ * with @c RTD_CalculateResistance.
+ *
+ * @param[in,out] table        Alarm table.
+ * @param[in]     channel      Channel number.
+ * @param[in]     sensor_type  The RTD sensor type of the channel.
+ * @param[in]     temperature  High limit in degrees Celsius.
+ * @param[in]     hysteresis   Hysteresis in kelvin (>= 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid (the limit is left unchanged).
+ */
+uint8_t RTD_Alarm_SetHighLimit(RTD_AlarmTable_t *table, uint32_t channel, uint16_t sensor_type, double temperature, double hysteresis);
+
+/**
+ * @brief Sets the low alarm limit of a channel.
+ *
+ * @details
+ * The limit and the clear point (@p temperature + @p hysteresis) are converted to resistance
+ * with @c RTD_CalculateResistance.
+ *
+ * @param[in,out] table        Alarm table.
+ * @param[in]     channel      Channel number.
+ * @param[in]     sensor_type  The RTD sensor type of the channel.
+ * @param[in]     temperature  Low limit in degrees Celsius.
+ * @param[in]     hysteresis   Hysteresis in kelvin (>= 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid (the limit is left unchanged).
+ */
+uint8_t RTD_Alarm_SetLowLimit(RTD_AlarmTable_t *table, uint32_t channel, uint16_t sensor_type, double temperature, double hysteresis);
+
+/**
+ * @brief Evaluates one frame of raw resistances against the alarm limits.
+ *
+ * @details
+ * Element i of @p resistances belongs to channel i. The state of every channel is updated with
+ * hysteresis using only resistance compares; no temperature conversion is performed.
+ *
+ * @param[in,out] table        Alarm table.
+ * @param[in]     resistances  Measured resistances in ohms, one per channel.
+ * @param[out]    alarm_mask   Optional bit mask receiving bit i set for every channel in alarm,
+ *                             ((channel_count + 31) / 32 words), suitable as the mask argument of
+ *                             @c RTD_CalculateTemperatureStrided. Pass @c NULL if not needed.
+ *
+ * @return Number of channels in alarm.
+ */
+uint32_t RTD_Alarm_Evaluate(RTD_AlarmTable_t *table, const double *resistances, uint32_t *alarm_mask);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_alarm.h */
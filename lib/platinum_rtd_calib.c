@@ -0,0 +1,286 @@
+/**
+ * @file    platinum_rtd_calib.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Callendar–Van Dusen coefficient fitting from multi-point calibration data.
+ *
+ * @details
+ * This file implements the calibration fitting functions declared in @c platinum_rtd_calib.h.
+ *
+ * @warning
+ * Ensure the input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_calib.h"    ///< Header file for RTD calibration functions.
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Largest number of fitted parameters (R0, R0 A, R0 B, R0 C) */
+#define  RTD_CALIB_MAX_COLUMNS  4U
+
+/** @brief Smallest diagonal of the triangular factor, relative to the largest, of a solvable fit */
+#define  RTD_CALIB_RANK_TOLERANCE  1.0e-9
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Rotates one weighted point into the triangular factor of the least-squares problem.
+ *
+ * @details
+ * Each Givens rotation zeroes one element of @p row against the diagonal of the triangle and
+ * applies the same rotation to the right-hand side, so after all points the triangle and
+ * @p rhs hold R and Q^T y of the QR factorization of the design matrix.
+ *
+ * @param[in,out] triangle      Upper triangle, row-major with @c RTD_CALIB_MAX_COLUMNS columns.
+ * @param[in,out] rhs           Rotated right-hand side.
+ * @param[in,out] row           Weighted design row of the point (destroyed).
+ * @param[in]     value         Weighted measured resistance of the point.
+ * @param[in]     column_count  Number of fitted parameters.
+ */
+static void RTD_GivensUpdate(double *triangle, double *rhs, double *row, double value, uint32_t column_count)
+{
+    uint32_t column = 0U, next = 0U;
+    double radius = 0.0, cosine = 0.0, sine = 0.0, upper = 0.0;
+
+    for (column = 0U; column < column_count; column++)
+    {
+        if (row[column] != 0.0)
+        {
+            upper = triangle[(column * RTD_CALIB_MAX_COLUMNS) + column];
+            radius = sqrt((upper * upper) + (row[column] * row[column]));
+            cosine = upper / radius;
+            sine = row[column] / radius;
+            triangle[(column * RTD_CALIB_MAX_COLUMNS) + column] = radius;
+
+            for (next = column + 1U; next < column_count; next++)
+            {
+                upper = triangle[(column * RTD_CALIB_MAX_COLUMNS) + next];
+                triangle[(column * RTD_CALIB_MAX_COLUMNS) + next] = (cosine * upper) + (sine * row[next]);
+                row[next] = (cosine * row[next]) - (sine * upper);
+            }
+
+            upper = rhs[column];
+            rhs[column] = (cosine * upper) + (sine * value);
+            value = (cosine * value) - (sine * upper);
+        }
+    }
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Fits the Callendar–Van Dusen coefficients of one sensor.
+ *
+ * @param[in]  temperatures  Reference temperatures in degrees Celsius, within -200°C to +850°C.
+ * @param[in]  resistances   Measured resistances in ohms.
+ * @param[in]  weights       Weight of each point (>= 0), or @c NULL to weight all points equally.
+ * @param[in]  point_count   Number of points; at least 3 distinct temperatures, and with
+ *                           sub-zero points at least 4.
+ * @param[out] result        Fitted coefficients and residuals.
+ *
+ * @return 1 on success, 0 if an argument is invalid, the points do not determine the
+ *         coefficients, or the fitted curve is not usable for conversion.
+ */
+uint8_t RTD_Calib_Fit(const double *temperatures, const double *resistances, const double *weights, uint32_t point_count,
+                      RTD_CalibrationResult_t *result)
+{
+    uint8_t is_valid = 0U, has_c = 0U, descriptor = RTD_INVALID_DESCRIPTOR;
+    uint32_t point = 0U, column = 0U, next = 0U, column_count = 0U, used = 0U;
+    double weight = 0.0, scale = 0.0, scaled = 0.0, diagonal = 0.0, largest = 0.0, sum = 0.0;
+    double temperature = 0.0, residual = 0.0, squares = 0.0, error = 0.0, max_error = 0.0, active_c = 0.0, slope = 0.0;
+    double triangle[RTD_CALIB_MAX_COLUMNS * RTD_CALIB_MAX_COLUMNS];
+    double rhs[RTD_CALIB_MAX_COLUMNS];
+    double row[RTD_CALIB_MAX_COLUMNS];
+    double solution[RTD_CALIB_MAX_COLUMNS];
+    RTD_DescriptorTable_t table;
+
+    if (result != NULL)
+    {
+        result->point_count = 0U;
+    }
+
+    if ( (temperatures != NULL) && (resistances != NULL) && (result != NULL) )
+    {
+        is_valid = 1U;
+
+        /* The C column is fitted only if some weighted point lies below 0°C */
+        for (point = 0U; point < point_count; point++)
+        {
+            weight = (weights != NULL) ? weights[point] : 1.0;
+
+            if ( (temperatures[point] < -200.0) || (temperatures[point] > 850.0) || (weight < 0.0) )
+            {
+                is_valid = 0U;
+            }
+            else if (weight > 0.0)
+            {
+                has_c |= (uint8_t)(temperatures[point] < 0.0);
+                used++;
+            }
+            else
+            {
+                /* Zero weight: point is ignored */
+            }
+        }
+
+        column_count = (has_c != 0U) ? RTD_CALIB_MAX_COLUMNS : (RTD_CALIB_MAX_COLUMNS - 1U);
+        is_valid &= (uint8_t)(used >= column_count);
+    }
+
+    if (is_valid != 0U)
+    {
+        for (column = 0U; column < (RTD_CALIB_MAX_COLUMNS * RTD_CALIB_MAX_COLUMNS); column++)
+        {
+            triangle[column] = 0.0;
+        }
+
+        for (column = 0U; column < RTD_CALIB_MAX_COLUMNS; column++)
+        {
+            rhs[column] = 0.0;
+        }
+
+        /* Columns 1, t, t^2, (t - 1) t^3 with t = T / 100 have comparable magnitudes */
+        for (point = 0U; point < point_count; point++)
+        {
+            weight = (weights != NULL) ? weights[point] : 1.0;
+
+            if (weight > 0.0)
+            {
+                scale = sqrt(weight);
+                scaled = temperatures[point] / 100.0;
+                row[0] = scale;
+                row[1] = scale * scaled;
+                row[2] = scale * scaled * scaled;
+                row[3] = (temperatures[point] < 0.0) ? (scale * (scaled - 1.0) * scaled * scaled * scaled) : 0.0;
+                RTD_GivensUpdate(triangle, rhs, row, scale * resistances[point], column_count);
+            }
+        }
+
+        for (column = 0U; column < column_count; column++)
+        {
+            diagonal = fabs(triangle[(column * RTD_CALIB_MAX_COLUMNS) + column]);
+            largest = (diagonal > largest) ? diagonal : largest;
+        }
+
+        for (column = 0U; column < column_count; column++)
+        {
+            if (fabs(triangle[(column * RTD_CALIB_MAX_COLUMNS) + column]) <= (RTD_CALIB_RANK_TOLERANCE * largest))
+            {
+                is_valid = 0U;
+            }
+        }
+    }
+
+    if (is_valid != 0U)
+    {
+        /* Back substitution, then undo the column scaling */
+        for (column = column_count; column > 0U; column--)
+        {
+            sum = rhs[column - 1U];
+
+            for (next = column; next < column_count; next++)
+            {
+                sum -= triangle[((column - 1U) * RTD_CALIB_MAX_COLUMNS) + next] * solution[next];
+            }
+
+            solution[column - 1U] = sum / triangle[((column - 1U) * RTD_CALIB_MAX_COLUMNS) + (column - 1U)];
+        }
+
+        result->resistance_at_zero = solution[0];
+        result->coefficient_a = solution[1] / (100.0 * solution[0]);
+        result->coefficient_b = solution[2] / (1.0e4 * solution[0]);
+        result->coefficient_c = (has_c != 0U) ? (solution[3] / (1.0e8 * solution[0])) : RTD_C_COEFFICIENT;
+        result->has_c = has_c;
+
+        /* Verify with the forward function that the conversions will use */
+        RTD_InitDescriptorTable(&table);
+        descriptor = RTD_AddCustomDescriptor(&table, result->resistance_at_zero, result->coefficient_a, result->coefficient_b,
+                                             result->coefficient_c);
+        is_valid = (uint8_t)(descriptor != RTD_INVALID_DESCRIPTOR);
+    }
+
+    if (is_valid != 0U)
+    {
+        for (point = 0U; point < point_count; point++)
+        {
+            weight = (weights != NULL) ? weights[point] : 1.0;
+
+            if (weight > 0.0)
+            {
+                temperature = temperatures[point];
+                residual = resistances[point] - RTD_CalculateDescriptorResistance(&table, descriptor, temperature);
+                active_c = (temperature < 0.0) ? result->coefficient_c : 0.0;
+                slope = result->resistance_at_zero * (result->coefficient_a + temperature * (2.0 * result->coefficient_b + active_c * temperature * (4.0 * temperature - 300.0)));
+                error = fabs(residual) / slope;
+                squares += residual * residual;
+                max_error = (error > max_error) ? error : max_error;
+            }
+        }
+
+        result->rms_residual = sqrt(squares / (double)used);
+        result->max_error = max_error;
+        result->point_count = used;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Fits the sensors of one chunk of a calibration data set.
+ *
+ * @details
+ * Fits sensors [chunk_index * chunk_size, min(sensor_count, (chunk_index + 1) * chunk_size))
+ * with @c RTD_Calib_Fit. Chunks write disjoint results, so a parallel engine can hand chunk
+ * indices from 0 to @c RTD_GetChunkCount(sensor_count, chunk_size) - 1 to its workers.
+ *
+ * @param[in]  data         Calibration points of all sensors.
+ * @param[out] results      @c sensor_count results (whole array). Failed fits have
+ *                          @c point_count set to 0.
+ * @param[in]  chunk_size   Sensors per chunk, or 0 for @c RTD_BATCH_CHUNK_SIZE.
+ * @param[in]  chunk_index  Index of the chunk to fit.
+ *
+ * @return Number of sensors of the chunk fitted successfully (0 if @p chunk_index is past the end).
+ */
+uint32_t RTD_Calib_FitChunk(const RTD_CalibrationData_t *data, RTD_CalibrationResult_t *results, uint32_t chunk_size, uint32_t chunk_index)
+{
+    uint32_t fitted = 0U, sensor = 0U, first = 0U, last = 0U, begin = 0U, end = 0U;
+
+    if (chunk_size == 0U)
+    {
+        chunk_size = RTD_BATCH_CHUNK_SIZE;
+    }
+
+    if ( (data != NULL) && (results != NULL) && (data->temperatures != NULL) && (data->resistances != NULL) && (data->offsets != NULL) &&
+         (chunk_index < RTD_GetChunkCount(data->sensor_count, chunk_size)) )
+    {
+        first = chunk_index * chunk_size;
+        last = ((data->sensor_count - first) < chunk_size) ? data->sensor_count : (first + chunk_size);
+
+        for (sensor = first; sensor < last; sensor++)
+        {
+            begin = data->offsets[sensor];
+            end = data->offsets[sensor + 1U];
+            results[sensor].point_count = 0U;
+
+            if (end >= begin)
+            {
+                fitted += RTD_Calib_Fit(&data->temperatures[begin], &data->resistances[begin],
+                                        (data->weights != NULL) ? &data->weights[begin] : NULL, end - begin, &results[sensor]);
+            }
+        }
+    }
+
+    return fitted;
+}
+
+
+/* platinum_rtd_calib.c */
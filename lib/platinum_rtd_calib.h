@@ -0,0 +1,118 @@
+/**
+ * @file    platinum_rtd_calib.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Callendar–Van Dusen coefficient fitting from multi-point calibration data.
+ *
+ * @details
+ * Calibration labs measure each sensor at a few bath temperatures and fit its individual R0, A,
+ * B and C. The Callendar–Van Dusen equation is linear in R0, R0 A, R0 B and R0 C, so the fit is
+ * a weighted linear least-squares problem:
+ *
+ *     R = R0 + (R0 A) T + (R0 B) T^2 + (R0 C) (T - 100) T^3     (last term only below 0°C)
+ *
+ * The C column is included only when the sensor has sub-zero points; otherwise C keeps its
+ * IEC 60751 value. The problem is solved by a Givens QR update on columns scaled by T / 100,
+ * one point at a time, so no normal equations (and their squared condition number) are formed
+ * and no storage beyond a 4x4 triangle is needed. Every fit is checked by re-evaluating the
+ * points with @c RTD_CalculateDescriptorResistance and the fitted coefficients.
+ *
+ * Many sensors are fitted in independent chunks, which a parallel engine distributes over its
+ * worker threads as with @c RTD_CalculateTemperatureChunk. The results are passed to
+ * @c RTD_AddCustomDescriptor to convert the measurements of the calibrated sensors.
+ *
+ * @warning
+ * Ensure the input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_CALIB_H
+#define _PLATINUM_RTD_CALIB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions and sensor descriptors
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Calibration points of many sensors.
+ *
+ * @details
+ * The points of sensor s are elements [offsets[s], offsets[s + 1]) of the point arrays.
+ */
+typedef struct
+{
+    const double *temperatures;    /**< Reference temperature of each point (°C)               */
+    const double *resistances;     /**< Measured resistance of each point (ohms)               */
+    const double *weights;         /**< Weight of each point (e.g. 1 / u^2), or @c NULL for 1  */
+    const uint32_t *offsets;       /**< sensor_count + 1 ascending point indices               */
+    uint32_t sensor_count;         /**< Number of sensors                                      */
+} RTD_CalibrationData_t;
+
+/** @brief Fitted coefficients of one sensor and the quality of the fit. */
+typedef struct
+{
+    double resistance_at_zero;    /**< Fitted R0 (ohms)                                           */
+    double coefficient_a;         /**< Fitted A coefficient                                       */
+    double coefficient_b;         /**< Fitted B coefficient                                       */
+    double coefficient_c;         /**< Fitted C coefficient, or @c RTD_C_COEFFICIENT if not fitted */
+    double rms_residual;          /**< RMS of measured minus fitted resistance (ohms)             */
+    double max_error;             /**< Largest residual as a temperature error (kelvin)           */
+    uint32_t point_count;         /**< Number of points used                                      */
+    uint8_t has_c;                /**< 1 if C was fitted from sub-zero points                     */
+} RTD_CalibrationResult_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Fits the Callendar–Van Dusen coefficients of one sensor.
+ *
+ * @param[in]  temperatures  Reference temperatures in degrees Celsius, within -200°C to +850°C.
+ * @param[in]  resistances   Measured resistances in ohms.
+ * @param[in]  weights       Weight of each point (>= 0), or @c NULL to weight all points equally.
+ * @param[in]  point_count   Number of points; at least 3 distinct temperatures, and with
+ *                           sub-zero points at least 4.
+ * @param[out] result        Fitted coefficients and residuals.
+ *
+ * @return 1 on success, 0 if an argument is invalid, the points do not determine the
+ *         coefficients, or the fitted curve is not usable for conversion.
+ */
+uint8_t RTD_Calib_Fit(const double *temperatures, const double *resistances, const double *weights, uint32_t point_count,
+                      RTD_CalibrationResult_t *result);
+
+/**
+ * @brief Fits the sensors of one chunk of a calibration data set.
+ *
+ * @details
+ * Fits sensors [chunk_index * chunk_size, min(sensor_count, (chunk_index + 1) * chunk_size))
+ * with @c RTD_Calib_Fit. Chunks write disjoint results, so a parallel engine can hand chunk
+ * indices from 0 to @c RTD_GetChunkCount(sensor_count, chunk_size) - 1 to its workers.
+ *
+ * @param[in]  data         Calibration points of all sensors.
+ * @param[out] results      @c sensor_count results (whole array). Failed fits have
+ *                          @c point_count set to 0.
+ * @param[in]  chunk_size   Sensors per chunk, or 0 for @c RTD_BATCH_CHUNK_SIZE.
+ * @param[in]  chunk_index  Index of the chunk to fit.
+ *
+ * @return Number of sensors of the chunk fitted successfully (0 if @p chunk_index is past the end).
+ */
+uint32_t RTD_Calib_FitChunk(const RTD_CalibrationData_t *data, RTD_CalibrationResult_t *results, uint32_t chunk_size, uint32_t chunk_index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_calib.h */
@@ -0,0 +1,161 @@
+/**
+ * @file    platinum_rtd_deadband.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Resistance-domain deadband change detection for platinum RTD channels.
+ *
+ * @details
+ * This file implements the per-channel deadband filter declared in @c platinum_rtd_deadband.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_deadband.h"    ///< Header file for RTD deadband functions.
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes a deadband filter.
+ *
+ * @details
+ * All channels start as @c RTD_SENSOR_PT100 with no anchor, so the first sample of every
+ * channel is reported.
+ *
+ * @param[out] filter             Deadband filter to initialize.
+ * @param[in]  anchor_resistance  Storage for @p channel_count anchor resistances.
+ * @param[in]  band               Storage for @p channel_count resistance bands.
+ * @param[in]  age                Storage for @p channel_count sample ages.
+ * @param[in]  sensor_types       Storage for @p channel_count sensor types.
+ * @param[in]  channel_count      Number of channels.
+ * @param[in]  deadband           Temperature deadband in kelvin (> 0).
+ * @param[in]  max_age            Discarded samples after which a report is forced (>= 1).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Deadband_Init(RTD_Deadband_t *filter, double *anchor_resistance, double *band, uint32_t *age, uint16_t *sensor_types,
+                          uint32_t channel_count, double deadband, uint32_t max_age)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+
+    if ( (filter != NULL) && (anchor_resistance != NULL) && (band != NULL) && (age != NULL) && (sensor_types != NULL) &&
+         (deadband > 0.0) && (max_age != 0U) )
+    {
+        filter->anchor_resistance = anchor_resistance;
+        filter->band = band;
+        filter->age = age;
+        filter->sensor_types = sensor_types;
+        filter->channel_count = channel_count;
+        filter->deadband = deadband;
+        filter->max_age = max_age;
+
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            (void)RTD_Deadband_SetChannel(filter, channel, RTD_SENSOR_PT100);
+        }
+
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Sets the sensor type of a channel and clears its anchor.
+ *
+ * @param[in,out] filter       Deadband filter.
+ * @param[in]     channel      Channel number.
+ * @param[in]     sensor_type  The RTD sensor type of the channel.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Deadband_SetChannel(RTD_Deadband_t *filter, uint32_t channel, uint16_t sensor_type)
+{
+    uint8_t is_valid = 0U;
+
+    if ( (filter != NULL) && (channel < filter->channel_count) )
+    {
+        /* An infinitely distant anchor forces the next sample to be reported */
+        filter->anchor_resistance[channel] = -HUGE_VAL;
+        filter->band[channel] = 0.0;
+        filter->age[channel] = 0U;
+        filter->sensor_types[channel] = sensor_type;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Filters one frame of raw resistances and converts only the reported samples.
+ *
+ * @details
+ * Element i of @p resistances belongs to channel i. For each reported sample the temperature is
+ * written to @p temperatures, the anchor moves to the sample and the band is recomputed from the
+ * sensitivity at the new temperature. Elements of @p temperatures for discarded samples are left
+ * untouched. A sample that cannot be converted is reported as @c RTD_CONVERSION_FAILED and does
+ * not move the anchor.
+ *
+ * @param[in,out] filter        Deadband filter.
+ * @param[in]     resistances   Measured resistances in ohms, one per channel.
+ * @param[out]    temperatures  Temperatures in degrees Celsius, one per channel.
+ * @param[out]    report_mask   Optional bit mask receiving bit i set for every reported channel
+ *                              ((channel_count + 31) / 32 words). Pass @c NULL if not needed.
+ *
+ * @return Number of reported samples.
+ */
+uint32_t RTD_Deadband_Process(RTD_Deadband_t *filter, const double *resistances, double *temperatures, uint32_t *report_mask)
+{
+    uint32_t channel = 0U, reported = 0U, report = 0U;
+    double resistance = 0.0, temperature = 0.0, sensitivity = 0.0;
+
+    if ( (filter != NULL) && (resistances != NULL) && (temperatures != NULL) )
+    {
+        for (channel = 0U; channel < filter->channel_count; channel++)
+        {
+            resistance = resistances[channel];
+            filter->age[channel]++;
+            report = ( (fabs(resistance - filter->anchor_resistance[channel]) > filter->band[channel]) ||
+                       (filter->age[channel] > filter->max_age) ) ? 1U : 0U;
+
+            if (report != 0U)
+            {
+                temperature = RTD_CONVERSION_FAILED;
+
+                if (RTD_CalculateTemperatureBatch(filter->sensor_types[channel], &resistance, &temperature, 1U) != 0U)
+                {
+                    sensitivity = RTD_CalculateSensitivity(filter->sensor_types[channel], temperature);
+                    filter->anchor_resistance[channel] = resistance;
+                    filter->band[channel] = filter->deadband * fabs(sensitivity);
+                    filter->age[channel] = 0U;
+                }
+
+                temperatures[channel] = temperature;
+                reported++;
+            }
+
+            if (report_mask != NULL)
+            {
+                if ((channel & 31U) == 0U)
+                {
+                    report_mask[channel >> 5U] = 0U;
+                }
+
+                report_mask[channel >> 5U] |= report << (channel & 31U);
+            }
+        }
+    }
+
+    return reported;
+}
+
+
+/* platinum_rtd_deadband.c */
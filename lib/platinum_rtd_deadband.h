@@ -0,0 +1,118 @@
+/**
+ * @file    platinum_rtd_deadband.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Resistance-domain deadband change detection for platinum RTD channels.
+ *
+ * @details
+ * Historians usually store a sample only when the temperature has moved by more than a deadband.
+ * This file turns the temperature deadband of each channel into a resistance deadband with the
+ * local sensitivity dR/dT (@c RTD_CalculateSensitivity) at the last stored temperature. Samples
+ * that stay inside the band are discarded with a single compare, and the inverse conversion runs
+ * only for samples that are reported. A sample is also reported after a maximum number of
+ * discarded samples, which re-anchors the band and bounds the linearization error.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_DEADBAND_H
+#define _PLATINUM_RTD_DEADBAND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Per-channel deadband state (structure-of-arrays).
+ *
+ * @details
+ * A sample of channel i is reported when |R - anchor_resistance[i]| > band[i] or when
+ * age[i] has reached @c max_age. All arrays are provided by the caller and hold
+ * @c channel_count elements.
+ */
+typedef struct
+{
+    double *anchor_resistance;    /**< Resistance of the last reported sample (ohms)      */
+    double *band;                 /**< Deadband converted to resistance (ohms)            */
+    uint32_t *age;                /**< Samples discarded since the last report            */
+    uint16_t *sensor_types;       /**< RTD sensor type of each channel                    */
+    uint32_t channel_count;       /**< Number of channels                                 */
+    double deadband;              /**< Temperature deadband in kelvin                     */
+    uint32_t max_age;             /**< Discarded samples after which a report is forced   */
+} RTD_Deadband_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes a deadband filter.
+ *
+ * @details
+ * All channels start as @c RTD_SENSOR_PT100 with no anchor, so the first sample of every
+ * channel is reported.
+ *
+ * @param[out] filter             Deadband filter to initialize.
+ * @param[in]  anchor_resistance  Storage for @p channel_count anchor resistances.
+ * @param[in]  band               Storage for @p channel_count resistance bands.
+ * @param[in]  age                Storage for @p channel_count sample ages.
+ * @param[in]  sensor_types       Storage for @p channel_count sensor types.
+ * @param[in]  channel_count      Number of channels.
+ * @param[in]  deadband           Temperature deadband in kelvin (> 0).
+ * @param[in]  max_age            Discarded samples after which a report is forced (>= 1).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Deadband_Init(RTD_Deadband_t *filter, double *anchor_resistance, double *band, uint32_t *age, uint16_t *sensor_types,
+                          uint32_t channel_count, double deadband, uint32_t max_age);
+
+/**
+ * @brief Sets the sensor type of a channel and clears its anchor.
+ *
+ * @param[in,out] filter       Deadband filter.
+ * @param[in]     channel      Channel number.
+ * @param[in]     sensor_type  The RTD sensor type of the channel.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Deadband_SetChannel(RTD_Deadband_t *filter, uint32_t channel, uint16_t sensor_type);
+
+/**
+ * @brief Filters one frame of raw resistances and converts only the reported samples.
+ *
+ * @details
+ * Element i of @p resistances belongs to channel i. For each reported sample the temperature is
+ * written to @p temperatures, the anchor moves to the sample and the band is recomputed from the
+ * sensitivity at the new temperature. Elements of @p temperatures for discarded samples are left
+ * untouched. A sample that cannot be converted is reported as @c RTD_CONVERSION_FAILED and does
+ * not move the anchor.
+ *
+ * @param[in,out] filter        Deadband filter.
+ * @param[in]     resistances   Measured resistances in ohms, one per channel.
+ * @param[out]    temperatures  Temperatures in degrees Celsius, one per channel.
+ * @param[out]    report_mask   Optional bit mask receiving bit i set for every reported channel
+ *                              ((channel_count + 31) / 32 words). Pass @c NULL if not needed.
+ *
+ * @return Number of reported samples.
+ */
+uint32_t RTD_Deadband_Process(RTD_Deadband_t *filter, const double *resistances, double *temperatures, uint32_t *report_mask);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_deadband.h */
@@ -0,0 +1,632 @@
+/**
+ * @file    platinum_rtd_diag.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Redundant-sensor voting and sensor fault diagnostics for platinum RTD channels.
+ *
+ * @details
+ * This file implements the voting stage, the fault monitor and the change detector declared in
+ * @c platinum_rtd_diag.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_diag.h"    ///< Header file for RTD diagnostic functions.
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Redundancy sets voted per block (stack use ~3 KiB) */
+#define  RTD_VOTE_BLOCK_SIZE  64U
+
+/** @brief Channels classified per block by the fault monitor */
+#define  RTD_MONITOR_BLOCK_SIZE  64U
+
+/** @brief Channels updated per block by the change detector */
+#define  RTD_CHANGE_BLOCK_SIZE  64U
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Working arrays of one block of redundancy sets.
+ *
+ * @details
+ * Keeping the arrays in one object lets compilers see that they do not overlap, so the vote
+ * loop vectorizes without run-time alias checks.
+ */
+typedef struct
+{
+    double first[RTD_VOTE_BLOCK_SIZE];          /**< Resistance of member 0 (ohms)           */
+    double second[RTD_VOTE_BLOCK_SIZE];         /**< Resistance of member 1 (ohms)           */
+    double third[RTD_VOTE_BLOCK_SIZE];          /**< Resistance of member 2 (ohms)           */
+    double selected[RTD_VOTE_BLOCK_SIZE];       /**< Selected resistance (ohms)              */
+    double spread[RTD_VOTE_BLOCK_SIZE];         /**< Spread of the valid members (ohms)      */
+    double valid_count[RTD_VOTE_BLOCK_SIZE];    /**< Number of valid members                 */
+} RTD_VoteBlock_t;
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Votes one block of gathered member resistances.
+ *
+ * @details
+ * Validity is carried as 0/1 weights. Invalid members are replaced by -1 ohm for the high
+ * selection and by +@c HUGE_VAL for the low selection, so they never win either. With three
+ * valid members the median is max(min(a, b), min(max(a, b), c)); with fewer, the median equals
+ * the mean of the valid members.
+ */
+static void RTD_VoteBlock(const RTD_Voter_t *voter, RTD_VoteBlock_t *block, uint32_t count)
+{
+    uint32_t index = 0U;
+    double a = 0.0, b = 0.0, c = 0.0, valid_a = 0.0, valid_b = 0.0, valid_c = 0.0, valid_count = 0.0;
+    double mean = 0.0, high = 0.0, low = 0.0, median = 0.0, choice = 0.0;
+    double resistance_min = voter->resistance_min;
+    double resistance_max = voter->resistance_max;
+    double has_third = (voter->member_count == RTD_VOTE_MAX_MEMBERS) ? 1.0 : 0.0;
+    uint8_t mode = voter->mode;
+
+    for (index = 0U; index < count; index++)
+    {
+        a = block->first[index];
+        b = block->second[index];
+        c = block->third[index];
+        valid_a = ((a >= resistance_min) && (a <= resistance_max)) ? 1.0 : 0.0;
+        valid_b = ((b >= resistance_min) && (b <= resistance_max)) ? 1.0 : 0.0;
+        valid_c = ((c >= resistance_min) && (c <= resistance_max)) ? has_third : 0.0;
+        valid_count = valid_a + valid_b + valid_c;
+
+        mean = ((valid_a * a) + (valid_b * b) + (valid_c * c)) / ((valid_count > 0.0) ? valid_count : 1.0);
+        high = (valid_a != 0.0) ? a : -1.0;
+        choice = (valid_b != 0.0) ? b : -1.0;
+        high = (choice > high) ? choice : high;
+        choice = (valid_c != 0.0) ? c : -1.0;
+        high = (choice > high) ? choice : high;
+        low = (valid_a != 0.0) ? a : HUGE_VAL;
+        choice = (valid_b != 0.0) ? b : HUGE_VAL;
+        low = (choice < low) ? choice : low;
+        choice = (valid_c != 0.0) ? c : HUGE_VAL;
+        low = (choice < low) ? choice : low;
+        median = (a < b) ? a : b;
+        choice = (a < b) ? b : a;
+        choice = (choice < c) ? choice : c;
+        median = (median < choice) ? choice : median;
+        median = (valid_count == 3.0) ? median : mean;
+
+        choice = (mode == RTD_VOTE_MEDIAN) ? median : ((mode == RTD_VOTE_HIGH) ? high : ((mode == RTD_VOTE_LOW) ? low : mean));
+        block->selected[index] = (valid_count > 0.0) ? choice : RTD_CONVERSION_FAILED;
+        block->spread[index] = (valid_count > 1.0) ? (high - low) : 0.0;
+        block->valid_count[index] = valid_count;
+    }
+}
+
+/**
+ * @brief Classifies one block of samples and updates the per-channel history.
+ *
+ * @details
+ * Conditions are combined with @c & instead of @c && and turned into flags arithmetically, so
+ * the loop has no branches. The run length counts the anchor sample, so a stuck fault is raised
+ * on the sample that completes @c stuck_samples equal readings. It saturates there, so a run of
+ * any length cannot wrap around and clear the fault.
+ */
+static void RTD_ClassifyBlock(RTD_Monitor_t *monitor, const double *resistances, uint32_t first_channel, uint32_t count, uint32_t *faults)
+{
+    uint32_t index = 0U, open = 0U, short_circuit = 0U, plausible = 0U, slew = 0U, still = 0U, run = 0U;
+    double resistance = 0.0, previous_resistance = 0.0, linear = 0.0, sensitivity = 0.0;
+    double resistance_at_zero = monitor->resistance_at_zero;
+    double resistance_min = monitor->resistance_min;
+    double resistance_max = monitor->resistance_max;
+    double slew_limit = monitor->slew_limit;
+    double stuck_band = monitor->stuck_band;
+    uint32_t stuck_samples = monitor->stuck_samples;
+    double *previous = &monitor->previous[first_channel];
+    double *anchor = &monitor->anchor[first_channel];
+    uint32_t *stuck_count = &monitor->stuck_count[first_channel];
+
+    for (index = 0U; index < count; index++)
+    {
+        resistance = resistances[index];
+        previous_resistance = previous[index];
+        open = (uint32_t)(resistance > resistance_max);
+        short_circuit = (uint32_t)(resistance < resistance_min);
+
+        /* Slew and stuck need a plausible sample and a plausible predecessor */
+        plausible = (uint32_t)((resistance >= resistance_min) & (resistance <= resistance_max) &
+                               (previous_resistance >= resistance_min) & (previous_resistance <= resistance_max));
+        linear = ((previous_resistance / resistance_at_zero) - 1.0) / RTD_A_COEFFICIENT;
+        sensitivity = resistance_at_zero * (RTD_A_COEFFICIENT + (2.0 * RTD_B_COEFFICIENT * linear));
+        slew = plausible & (uint32_t)(fabs(resistance - previous_resistance) > (slew_limit * sensitivity));
+        still = plausible & (uint32_t)(fabs(resistance - anchor[index]) <= (stuck_band * sensitivity));
+
+        run = (still * stuck_count[index]) + 1U;
+        run = (run > stuck_samples) ? stuck_samples : run;
+        anchor[index] = (still != 0U) ? anchor[index] : resistance;
+        stuck_count[index] = run;
+        previous[index] = resistance;
+        faults[index] = (open * RTD_FAULT_OPEN) | (short_circuit * RTD_FAULT_SHORT) | (slew * RTD_FAULT_SLEW) |
+                        ((uint32_t)(run >= stuck_samples) * RTD_FAULT_STUCK);
+    }
+}
+
+/**
+ * @brief Applies one temperature to the CUSUM state of one channel.
+ *
+ * @details
+ * Validity and priming are carried as 0/1 weights: an inactive sample adds nothing to the sums
+ * and no allowance, so they keep their value. A change point clears both sums and restarts the
+ * reference at the sample, as does the first valid sample of an unprimed channel.
+ *
+ * @return Change direction (@c RTD_CHANGE_x) as a double.
+ */
+static double RTD_ChangeStep(double *reference, double *upper, double *lower, double temperature, double drift, double threshold,
+                             double smoothing)
+{
+    double level = *reference, valid = 0.0, primed = 0.0, active = 0.0, error = 0.0;
+    double rise = 0.0, fall = 0.0, up = 0.0, down = 0.0, change = 0.0, restart = 0.0;
+
+    valid = (temperature != RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+    primed = (level != RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+    active = valid * primed;
+    error = active * (temperature - level);
+
+    up = *upper + error - (active * drift);
+    up = (up > 0.0) ? up : 0.0;
+    down = *lower - error - (active * drift);
+    down = (down > 0.0) ? down : 0.0;
+    rise = (up > threshold) ? 1.0 : 0.0;
+    fall = (down > threshold) ? 1.0 : 0.0;
+    change = rise + fall - (rise * fall);
+    restart = change + (valid * (1.0 - primed));
+
+    *reference = (restart > 0.0) ? temperature : (level + (smoothing * error));
+    *upper = (1.0 - change) * up;
+    *lower = (1.0 - change) * down;
+
+    return (rise * (double)RTD_CHANGE_UP) + (fall * (double)RTD_CHANGE_DOWN);
+}
+
+/**
+ * @brief Updates one block of consecutive channels of the change detector.
+ */
+static void RTD_ChangeBlock(RTD_ChangeDetector_t *detector, const double *temperatures, uint32_t first_channel, uint32_t count, double *changes)
+{
+    uint32_t index = 0U;
+    double drift = detector->drift;
+    double threshold = detector->threshold;
+    double smoothing = detector->smoothing;
+    double *reference = &detector->reference[first_channel];
+    double *upper = &detector->upper[first_channel];
+    double *lower = &detector->lower[first_channel];
+
+    for (index = 0U; index < count; index++)
+    {
+        changes[index] = RTD_ChangeStep(&reference[index], &upper[index], &lower[index], temperatures[index], drift, threshold, smoothing);
+    }
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes a voter.
+ *
+ * @param[out] voter          Voter to initialize.
+ * @param[in]  sensor_type    The RTD sensor type of all members.
+ * @param[in]  members        @p member_count * @p set_count channel numbers (see @c RTD_Voter_t).
+ * @param[in]  set_count      Number of redundancy sets.
+ * @param[in]  member_count   Members per set, 2 or @c RTD_VOTE_MAX_MEMBERS.
+ * @param[in]  channel_count  Number of channels of the resistance frames; every member must be
+ *                            below it.
+ * @param[in]  mode           Voting mode (@c RTD_VOTE_x).
+ * @param[in]  discrepancy    Largest accepted spread of a set in kelvin (> 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Voter_Init(RTD_Voter_t *voter, uint16_t sensor_type, const uint32_t *members, uint32_t set_count, uint8_t member_count,
+                       uint32_t channel_count, uint8_t mode, double discrepancy)
+{
+    uint8_t is_valid = 0U;
+    size_t index = 0U;
+    double resistance_min = 0.0, resistance_max = 0.0;
+
+    if ( (voter != NULL) && (members != NULL) && ((member_count == 2U) || (member_count == RTD_VOTE_MAX_MEMBERS)) &&
+         (mode <= RTD_VOTE_LOW) && (discrepancy > 0.0) &&
+         (RTD_GetResistanceRange(sensor_type, &resistance_min, &resistance_max) != 0U) )
+    {
+        is_valid = 1U;
+
+        for (index = 0U; index < ((size_t)member_count * set_count); index++)
+        {
+            is_valid &= (uint8_t)(members[index] < channel_count);
+        }
+
+        if (is_valid != 0U)
+        {
+            voter->members = members;
+            voter->set_count = set_count;
+            voter->member_count = member_count;
+            voter->mode = mode;
+            voter->sensor_type = sensor_type;
+            voter->resistance_at_zero = RTD_CalculateResistance(sensor_type, 0.0);
+            voter->resistance_min = resistance_min;
+            voter->resistance_max = resistance_max;
+            voter->discrepancy = discrepancy;
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Votes every redundancy set of one resistance frame and converts the selected values.
+ *
+ * @param[in]  voter              Voter.
+ * @param[in]  resistances        Resistance frame in ohms, indexed by channel number.
+ * @param[out] temperatures       Selected temperature of each set in degrees Celsius, or
+ *                                @c RTD_CONVERSION_FAILED if no member is valid.
+ * @param[out] discrepancy_mask   Optional bit mask receiving bit s set for every set in
+ *                                discrepancy alarm ((set_count + 31) / 32 words). Pass @c NULL
+ *                                if not needed.
+ * @param[out] degraded_mask      Optional bit mask receiving bit s set for every set with at
+ *                                least one invalid member. Pass @c NULL if not needed.
+ *
+ * @return Number of sets in discrepancy alarm.
+ */
+uint32_t RTD_Voter_Process(const RTD_Voter_t *voter, const double *resistances, double *temperatures,
+                           uint32_t *discrepancy_mask, uint32_t *degraded_mask)
+{
+    uint32_t first = 0U, length = 0U, index = 0U, set = 0U, alarms = 0U, alarm = 0U, degraded = 0U;
+    double temperature = 0.0, active_c = 0.0, sensitivity = 0.0;
+    const uint32_t *first_channels = NULL, *second_channels = NULL, *third_channels = NULL;
+    RTD_VoteBlock_t block;
+
+    if ( (voter != NULL) && (resistances != NULL) && (temperatures != NULL) )
+    {
+        first_channels = voter->members;
+        second_channels = &voter->members[voter->set_count];
+        third_channels = (voter->member_count == RTD_VOTE_MAX_MEMBERS) ? &voter->members[(size_t)2U * voter->set_count] : first_channels;
+
+        for (first = 0U; first < voter->set_count; first += length)
+        {
+            length = ((voter->set_count - first) < RTD_VOTE_BLOCK_SIZE) ? (voter->set_count - first) : RTD_VOTE_BLOCK_SIZE;
+
+            /* Gather the member resistances of the block */
+            for (index = 0U; index < length; index++)
+            {
+                block.first[index] = resistances[first_channels[first + index]];
+                block.second[index] = resistances[second_channels[first + index]];
+                block.third[index] = resistances[third_channels[first + index]];
+            }
+
+            /* Vote across sets, then convert only the selected resistances */
+            RTD_VoteBlock(voter, &block, length);
+            (void)RTD_CalculateTemperatureBatch(voter->sensor_type, block.selected, &temperatures[first], length);
+
+            for (index = 0U; index < length; index++)
+            {
+                set = first + index;
+                temperature = temperatures[set];
+                active_c = (temperature < 0.0) ? RTD_C_COEFFICIENT : 0.0;
+                sensitivity = voter->resistance_at_zero * (RTD_A_COEFFICIENT + temperature * (2.0 * RTD_B_COEFFICIENT + active_c * temperature * (4.0 * temperature - 300.0)));
+                alarm = ( (temperature != RTD_CONVERSION_FAILED) && (block.spread[index] > (voter->discrepancy * sensitivity)) ) ? 1U : 0U;
+                degraded = (block.valid_count[index] < (double)voter->member_count) ? 1U : 0U;
+                alarms += alarm;
+
+                if ((set & 31U) == 0U)
+                {
+                    if (discrepancy_mask != NULL)
+                    {
+                        discrepancy_mask[set >> 5U] = 0U;
+                    }
+
+                    if (degraded_mask != NULL)
+                    {
+                        degraded_mask[set >> 5U] = 0U;
+                    }
+                }
+
+                if (discrepancy_mask != NULL)
+                {
+                    discrepancy_mask[set >> 5U] |= alarm << (set & 31U);
+                }
+
+                if (degraded_mask != NULL)
+                {
+                    degraded_mask[set >> 5U] |= degraded << (set & 31U);
+                }
+            }
+        }
+    }
+
+    return alarms;
+}
+
+/**
+ * @brief Initializes a fault monitor with no faults and no history.
+ *
+ * @param[out] monitor        Monitor to initialize.
+ * @param[in]  sensor_type    The RTD sensor type of all channels.
+ * @param[in]  previous       Storage for @p channel_count resistances.
+ * @param[in]  anchor         Storage for @p channel_count anchors.
+ * @param[in]  stuck_count    Storage for @p channel_count run lengths.
+ * @param[in]  state          Storage for @p channel_count fault flags.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  slew_limit     Largest plausible change between two samples in kelvin (> 0).
+ * @param[in]  stuck_band     Change regarded as no movement in kelvin (>= 0; 0 detects only
+ *                            bit-identical readings).
+ * @param[in]  stuck_samples  Run length reported as stuck (>= 2).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Monitor_Init(RTD_Monitor_t *monitor, uint16_t sensor_type, double *previous, double *anchor, uint32_t *stuck_count,
+                         uint8_t *state, uint32_t channel_count, double slew_limit, double stuck_band, uint32_t stuck_samples)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+    double resistance_min = 0.0, resistance_max = 0.0;
+
+    if ( (monitor != NULL) && (previous != NULL) && (anchor != NULL) && (stuck_count != NULL) && (state != NULL) &&
+         (slew_limit > 0.0) && (stuck_band >= 0.0) && (stuck_samples >= 2U) &&
+         (RTD_GetResistanceRange(sensor_type, &resistance_min, &resistance_max) != 0U) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            previous[channel] = RTD_CONVERSION_FAILED;
+            anchor[channel] = RTD_CONVERSION_FAILED;
+            stuck_count[channel] = 0U;
+            state[channel] = RTD_FAULT_NONE;
+        }
+
+        monitor->previous = previous;
+        monitor->anchor = anchor;
+        monitor->stuck_count = stuck_count;
+        monitor->state = state;
+        monitor->channel_count = channel_count;
+        monitor->resistance_at_zero = RTD_CalculateResistance(sensor_type, 0.0);
+        monitor->resistance_min = resistance_min;
+        monitor->resistance_max = resistance_max;
+        monitor->slew_limit = slew_limit;
+        monitor->stuck_band = stuck_band;
+        monitor->stuck_samples = stuck_samples;
+        monitor->frame = 0U;
+        monitor->dropped = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Classifies one frame of raw resistances and reports fault changes.
+ *
+ * @details
+ * The classification runs across channels without branches. Open and short circuits are
+ * decided from the sample alone; slew and stuck faults need a plausible previous sample. An
+ * event is written for every channel whose flags differ from the previous frame; events beyond
+ * @p event_capacity are counted in @c dropped.
+ *
+ * @param[in,out] monitor         Monitor.
+ * @param[in]     resistances     @c channel_count resistances in ohms, one per channel.
+ * @param[out]    events          Event buffer, or @c NULL to only update @c state.
+ * @param[in]     event_capacity  Number of elements of @p events.
+ *
+ * @return Number of events written.
+ */
+uint32_t RTD_Monitor_Process(RTD_Monitor_t *monitor, const double *resistances, RTD_FaultEvent_t *events, uint32_t event_capacity)
+{
+    uint32_t first = 0U, length = 0U, index = 0U, channel = 0U, written = 0U;
+    uint8_t faults = 0U, changed = 0U;
+    uint32_t block_faults[RTD_MONITOR_BLOCK_SIZE];
+
+    if ( (monitor != NULL) && (resistances != NULL) )
+    {
+        for (first = 0U; first < monitor->channel_count; first += length)
+        {
+            length = ((monitor->channel_count - first) < RTD_MONITOR_BLOCK_SIZE) ? (monitor->channel_count - first) : RTD_MONITOR_BLOCK_SIZE;
+            RTD_ClassifyBlock(monitor, &resistances[first], first, length, block_faults);
+
+            /* Faults change rarely, so the event scan is a cheap compare per channel */
+            for (index = 0U; index < length; index++)
+            {
+                channel = first + index;
+                faults = (uint8_t)block_faults[index];
+                changed = (uint8_t)(faults ^ monitor->state[channel]);
+
+                if (changed != 0U)
+                {
+                    if (events != NULL)
+                    {
+                        if (written < event_capacity)
+                        {
+                            events[written].frame = monitor->frame;
+                            events[written].channel = channel;
+                            events[written].faults = faults;
+                            events[written].changed = changed;
+                            written++;
+                        }
+                        else
+                        {
+                            monitor->dropped++;
+                        }
+                    }
+
+                    monitor->state[channel] = faults;
+                }
+            }
+        }
+
+        monitor->frame++;
+    }
+
+    return written;
+}
+
+/**
+ * @brief Initializes a change detector with every channel unprimed.
+ *
+ * @param[out] detector       Detector to initialize.
+ * @param[in]  reference      Storage for @p channel_count reference levels.
+ * @param[in]  upper          Storage for @p channel_count sums of rises.
+ * @param[in]  lower          Storage for @p channel_count sums of falls.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  drift          Allowance per sample in kelvin (>= 0), typically half the smallest
+ *                            step to detect.
+ * @param[in]  threshold      Decision threshold in kelvin (> 0).
+ * @param[in]  smoothing      Weight of a new sample in the reference, in [0, 1).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_ChangeDetector_Init(RTD_ChangeDetector_t *detector, double *reference, double *upper, double *lower, uint32_t channel_count,
+                                double drift, double threshold, double smoothing)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+
+    if ( (detector != NULL) && (reference != NULL) && (upper != NULL) && (lower != NULL) && (drift >= 0.0) && (threshold > 0.0) &&
+         (smoothing >= 0.0) && (smoothing < 1.0) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            reference[channel] = RTD_CONVERSION_FAILED;
+            upper[channel] = 0.0;
+            lower[channel] = 0.0;
+        }
+
+        detector->reference = reference;
+        detector->upper = upper;
+        detector->lower = lower;
+        detector->channel_count = channel_count;
+        detector->drift = drift;
+        detector->threshold = threshold;
+        detector->smoothing = smoothing;
+        detector->detections = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Updates every channel with one frame of temperatures.
+ *
+ * @details
+ * The update runs across channels without branches. Samples equal to
+ * @c RTD_CONVERSION_FAILED leave their channel unchanged, and the first valid sample of a
+ * channel only primes its reference.
+ *
+ * @param[in,out] detector     Detector.
+ * @param[in]     temperatures @c channel_count temperatures in degrees Celsius, one per channel.
+ * @param[out]    rise_mask    Optional bit mask receiving bit i set for every channel whose level
+ *                             has risen ((channel_count + 31) / 32 words). Pass @c NULL if not needed.
+ * @param[out]    fall_mask    Optional bit mask receiving bit i set for every channel whose level
+ *                             has fallen. Pass @c NULL if not needed.
+ *
+ * @return Number of change points in the frame.
+ */
+uint32_t RTD_ChangeDetector_Process(RTD_ChangeDetector_t *detector, const double *temperatures, uint32_t *rise_mask, uint32_t *fall_mask)
+{
+    uint32_t first = 0U, length = 0U, index = 0U, channel = 0U, change = 0U, detections = 0U;
+    double block_changes[RTD_CHANGE_BLOCK_SIZE];
+
+    if ( (detector != NULL) && (temperatures != NULL) )
+    {
+        for (first = 0U; first < detector->channel_count; first += length)
+        {
+            length = ((detector->channel_count - first) < RTD_CHANGE_BLOCK_SIZE) ? (detector->channel_count - first) : RTD_CHANGE_BLOCK_SIZE;
+            RTD_ChangeBlock(detector, &temperatures[first], first, length, block_changes);
+
+            for (index = 0U; index < length; index++)
+            {
+                channel = first + index;
+                change = (uint32_t)block_changes[index];
+                detections += (change != RTD_CHANGE_NONE) ? 1U : 0U;
+
+                if ((channel & 31U) == 0U)
+                {
+                    if (rise_mask != NULL)
+                    {
+                        rise_mask[channel >> 5U] = 0U;
+                    }
+
+                    if (fall_mask != NULL)
+                    {
+                        fall_mask[channel >> 5U] = 0U;
+                    }
+                }
+
+                if (rise_mask != NULL)
+                {
+                    rise_mask[channel >> 5U] |= (change & RTD_CHANGE_UP) << (channel & 31U);
+                }
+
+                if (fall_mask != NULL)
+                {
+                    fall_mask[channel >> 5U] |= ((change & RTD_CHANGE_DOWN) >> 1U) << (channel & 31U);
+                }
+            }
+        }
+
+        detector->detections += detections;
+    }
+
+    return detections;
+}
+
+/**
+ * @brief Updates the detector with a sequence of samples of arbitrary channels.
+ *
+ * @details
+ * Samples are applied in order, so a channel may appear several times. Samples of channels
+ * beyond @c channel_count, and samples equal to @c RTD_CONVERSION_FAILED, are ignored.
+ *
+ * @param[in,out] detector      Detector.
+ * @param[in]     channels      Channel number of each sample.
+ * @param[in]     temperatures  Temperature of each sample in degrees Celsius.
+ * @param[out]    changes       Optional change direction of each sample (@c RTD_CHANGE_x). Pass
+ *                              @c NULL if not needed.
+ * @param[in]     count         Number of samples.
+ *
+ * @return Number of change points among the samples.
+ */
+uint32_t RTD_ChangeDetector_Update(RTD_ChangeDetector_t *detector, const uint32_t *channels, const double *temperatures, uint8_t *changes,
+                                   uint32_t count)
+{
+    uint32_t index = 0U, channel = 0U, detections = 0U;
+    uint8_t change = 0U;
+
+    if ( (detector != NULL) && (channels != NULL) && (temperatures != NULL) )
+    {
+        for (index = 0U; index < count; index++)
+        {
+            channel = channels[index];
+            change = RTD_CHANGE_NONE;
+
+            if (channel < detector->channel_count)
+            {
+                change = (uint8_t)RTD_ChangeStep(&detector->reference[channel], &detector->upper[channel], &detector->lower[channel],
+                                                 temperatures[index], detector->drift, detector->threshold, detector->smoothing);
+                detections += (change != RTD_CHANGE_NONE) ? 1U : 0U;
+            }
+
+            if (changes != NULL)
+            {
+                changes[index] = change;
+            }
+        }
+
+        detector->detections += detections;
+    }
+
+    return detections;
+}
+
+
+/* platinum_rtd_diag.c */
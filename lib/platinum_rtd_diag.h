@@ -0,0 +1,310 @@
+/**
+ * @file    platinum_rtd_diag.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Redundant-sensor voting and sensor fault diagnostics for platinum RTD channels.
+ *
+ * @details
+ * Safety-instrumented functions read two or three sensors of the same type per measurement
+ * point (1oo2, 2oo3) and vote. Because the Callendar–Van Dusen curve is strictly increasing,
+ * median, high and low selection give the same sensor in the resistance domain as in the
+ * temperature domain, so this file votes on raw resistances and converts only the selected
+ * value of each set. Sets are processed in blocks: member resistances are gathered once, and the
+ * vote itself is a branch-free loop across sets that compilers vectorize.
+ *
+ * A streaming monitor classifies every raw sample before conversion: open and short circuits
+ * from the range limits of the sensor type, impossible slew rates, and stuck readings. Each
+ * sample costs O(1) with per-channel state, and fault changes are reported as compact event
+ * records.
+ *
+ * A two-sided CUSUM detector watches converted temperatures for regime changes (a heater
+ * switched on, a valve opened) rather than threshold crossings. It keeps three doubles per
+ * channel, so memory is bounded and each sample costs O(1).
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_DIAG_H
+#define _PLATINUM_RTD_DIAG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @name Voting Modes
+ *  @{
+ */
+#define  RTD_VOTE_MEDIAN  0U    /**< Median of the valid members (2oo3)          */
+#define  RTD_VOTE_MEAN    1U    /**< Mean of the valid members                   */
+#define  RTD_VOTE_HIGH    2U    /**< Highest valid member (1oo2 high trip)       */
+#define  RTD_VOTE_LOW     3U    /**< Lowest valid member (1oo2 low trip)         */
+/** @} */
+
+
+/** @brief Largest number of members of a redundancy set */
+#define  RTD_VOTE_MAX_MEMBERS  3U    /**< 2oo3 */
+
+
+/** @name Sensor Fault Flags
+ *  @{
+ */
+#define  RTD_FAULT_NONE   0x00U    /**< Sample is plausible                              */
+#define  RTD_FAULT_OPEN   0x01U    /**< Resistance above range (open circuit)            */
+#define  RTD_FAULT_SHORT  0x02U    /**< Resistance below range (short circuit)           */
+#define  RTD_FAULT_SLEW   0x04U    /**< Change since the last sample exceeds the limit   */
+#define  RTD_FAULT_STUCK  0x08U    /**< Reading has not moved for too many samples       */
+/** @} */
+
+
+/** @name Change Directions
+ *  @{
+ */
+#define  RTD_CHANGE_NONE  0x00U    /**< No change point                  */
+#define  RTD_CHANGE_UP    0x01U    /**< Level has risen                  */
+#define  RTD_CHANGE_DOWN  0x02U    /**< Level has fallen                 */
+/** @} */
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Redundancy sets of one sensor type and their voting rule.
+ *
+ * @details
+ * Member k of set s is the channel members[k * set_count + s] of the resistance frame. A member
+ * is valid when its resistance is within the range of the sensor type; invalid members are
+ * left out of the vote, so a 2oo3 set with one failed sensor degrades to the mean of the other
+ * two. A set raises a discrepancy alarm when the spread of its valid members exceeds
+ * @c discrepancy kelvin, converted to resistance with the sensitivity at the selected temperature.
+ */
+typedef struct
+{
+    const uint32_t *members;      /**< member_count * set_count channel numbers             */
+    uint32_t set_count;           /**< Number of redundancy sets                            */
+    uint8_t member_count;         /**< Members per set (2 or 3)                             */
+    uint8_t mode;                 /**< Voting mode (@c RTD_VOTE_x)                          */
+    uint16_t sensor_type;         /**< RTD sensor type of all members                       */
+    double resistance_at_zero;    /**< R0 of @c sensor_type (ohms)                          */
+    double resistance_min;        /**< Lowest valid resistance (ohms)                       */
+    double resistance_max;        /**< Highest valid resistance (ohms)                      */
+    double discrepancy;           /**< Largest accepted spread of a set (kelvin)            */
+} RTD_Voter_t;
+
+/**
+ * @brief Per-channel sensor fault monitor (structure-of-arrays).
+ *
+ * @details
+ * Temperature limits are turned into resistance bands with the sensitivity at the linearized
+ * temperature (R / R0 - 1) / A of the previous sample, which is within 5% of dR/dT over the
+ * whole range. A channel is stuck when its readings have stayed within @c stuck_band of an
+ * anchor for @c stuck_samples consecutive samples. All arrays are provided by the caller and
+ * hold @c channel_count elements.
+ */
+typedef struct
+{
+    double *previous;             /**< Last resistance (unprimed: @c RTD_CONVERSION_FAILED)   */
+    double *anchor;               /**< Start of the current run of unchanged readings (ohms)  */
+    uint32_t *stuck_count;        /**< Samples in the current run                             */
+    uint8_t *state;               /**< Current fault flags (@c RTD_FAULT_x)                   */
+    uint32_t channel_count;       /**< Number of channels                                     */
+    double resistance_at_zero;    /**< R0 of the sensor type (ohms)                           */
+    double resistance_min;        /**< Lowest plausible resistance (ohms)                     */
+    double resistance_max;        /**< Highest plausible resistance (ohms)                    */
+    double slew_limit;            /**< Largest plausible change per sample (kelvin)           */
+    double stuck_band;            /**< Change regarded as no movement (kelvin)                */
+    uint32_t stuck_samples;       /**< Run length reported as stuck                           */
+    uint64_t frame;               /**< Number of processed frames                             */
+    uint64_t dropped;             /**< Events lost because the event buffer was full          */
+} RTD_Monitor_t;
+
+/** @brief Change of the fault flags of one channel. */
+typedef struct
+{
+    uint64_t frame;       /**< Frame number of the sample (@c RTD_Monitor_t::frame)   */
+    uint32_t channel;     /**< Channel number                                        */
+    uint8_t faults;       /**< Fault flags after the sample                          */
+    uint8_t changed;      /**< Flags raised or cleared by the sample                 */
+} RTD_FaultEvent_t;
+
+/**
+ * @brief Per-channel CUSUM change-point detector (structure-of-arrays).
+ *
+ * @details
+ * Each channel tracks a reference level and two cumulative sums of its deviation from it,
+ * less the allowance @c drift:
+ *
+ *     upper = max(0, upper + (T - reference) - drift)
+ *     lower = max(0, lower - (T - reference) - drift)
+ *
+ * A change point is reported when either sum exceeds @c threshold; the channel then restarts
+ * with the current sample as reference. Between change points the reference follows the
+ * samples with weight @c smoothing, so slow drifts are absorbed and only steps are reported
+ * (0 keeps the reference fixed, as in the classic CUSUM). A step of d kelvin is reported after
+ * about threshold / (d - drift) samples. All arrays are provided by the caller and hold
+ * @c channel_count elements.
+ */
+typedef struct
+{
+    double *reference;            /**< Reference level (unprimed: @c RTD_CONVERSION_FAILED)   */
+    double *upper;                /**< Cumulative sum of rises (kelvin)                       */
+    double *lower;                /**< Cumulative sum of falls (kelvin)                       */
+    uint32_t channel_count;       /**< Number of channels                                     */
+    double drift;                 /**< Allowance per sample (kelvin)                          */
+    double threshold;             /**< Decision threshold (kelvin)                            */
+    double smoothing;             /**< Weight of a new sample in the reference                */
+    uint64_t detections;          /**< Change points reported since initialization            */
+} RTD_ChangeDetector_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes a voter.
+ *
+ * @param[out] voter          Voter to initialize.
+ * @param[in]  sensor_type    The RTD sensor type of all members.
+ * @param[in]  members        @p member_count * @p set_count channel numbers (see @c RTD_Voter_t).
+ * @param[in]  set_count      Number of redundancy sets.
+ * @param[in]  member_count   Members per set, 2 or @c RTD_VOTE_MAX_MEMBERS.
+ * @param[in]  channel_count  Number of channels of the resistance frames; every member must be
+ *                            below it.
+ * @param[in]  mode           Voting mode (@c RTD_VOTE_x).
+ * @param[in]  discrepancy    Largest accepted spread of a set in kelvin (> 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Voter_Init(RTD_Voter_t *voter, uint16_t sensor_type, const uint32_t *members, uint32_t set_count, uint8_t member_count,
+                       uint32_t channel_count, uint8_t mode, double discrepancy);
+
+/**
+ * @brief Votes every redundancy set of one resistance frame and converts the selected values.
+ *
+ * @param[in]  voter              Voter.
+ * @param[in]  resistances        Resistance frame in ohms, indexed by channel number.
+ * @param[out] temperatures       Selected temperature of each set in degrees Celsius, or
+ *                                @c RTD_CONVERSION_FAILED if no member is valid.
+ * @param[out] discrepancy_mask   Optional bit mask receiving bit s set for every set in
+ *                                discrepancy alarm ((set_count + 31) / 32 words). Pass @c NULL
+ *                                if not needed.
+ * @param[out] degraded_mask      Optional bit mask receiving bit s set for every set with at
+ *                                least one invalid member. Pass @c NULL if not needed.
+ *
+ * @return Number of sets in discrepancy alarm.
+ */
+uint32_t RTD_Voter_Process(const RTD_Voter_t *voter, const double *resistances, double *temperatures,
+                           uint32_t *discrepancy_mask, uint32_t *degraded_mask);
+
+/**
+ * @brief Initializes a fault monitor with no faults and no history.
+ *
+ * @param[out] monitor        Monitor to initialize.
+ * @param[in]  sensor_type    The RTD sensor type of all channels.
+ * @param[in]  previous       Storage for @p channel_count resistances.
+ * @param[in]  anchor         Storage for @p channel_count anchors.
+ * @param[in]  stuck_count    Storage for @p channel_count run lengths.
+ * @param[in]  state          Storage for @p channel_count fault flags.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  slew_limit     Largest plausible change between two samples in kelvin (> 0).
+ * @param[in]  stuck_band     Change regarded as no movement in kelvin (>= 0; 0 detects only
+ *                            bit-identical readings).
+ * @param[in]  stuck_samples  Run length reported as stuck (>= 2).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Monitor_Init(RTD_Monitor_t *monitor, uint16_t sensor_type, double *previous, double *anchor, uint32_t *stuck_count,
+                         uint8_t *state, uint32_t channel_count, double slew_limit, double stuck_band, uint32_t stuck_samples);
+
+/**
+ * @brief Classifies one frame of raw resistances and reports fault changes.
+ *
+ * @details
+ * The classification runs across channels without branches. Open and short circuits are
+ * decided from the sample alone; slew and stuck faults need a plausible previous sample. An
+ * event is written for every channel whose flags differ from the previous frame; events beyond
+ * @p event_capacity are counted in @c dropped.
+ *
+ * @param[in,out] monitor         Monitor.
+ * @param[in]     resistances     @c channel_count resistances in ohms, one per channel.
+ * @param[out]    events          Event buffer, or @c NULL to only update @c state.
+ * @param[in]     event_capacity  Number of elements of @p events.
+ *
+ * @return Number of events written.
+ */
+uint32_t RTD_Monitor_Process(RTD_Monitor_t *monitor, const double *resistances, RTD_FaultEvent_t *events, uint32_t event_capacity);
+
+/**
+ * @brief Initializes a change detector with every channel unprimed.
+ *
+ * @param[out] detector       Detector to initialize.
+ * @param[in]  reference      Storage for @p channel_count reference levels.
+ * @param[in]  upper          Storage for @p channel_count sums of rises.
+ * @param[in]  lower          Storage for @p channel_count sums of falls.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  drift          Allowance per sample in kelvin (>= 0), typically half the smallest
+ *                            step to detect.
+ * @param[in]  threshold      Decision threshold in kelvin (> 0).
+ * @param[in]  smoothing      Weight of a new sample in the reference, in [0, 1).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_ChangeDetector_Init(RTD_ChangeDetector_t *detector, double *reference, double *upper, double *lower, uint32_t channel_count,
+                                double drift, double threshold, double smoothing);
+
+/**
+ * @brief Updates every channel with one frame of temperatures.
+ *
+ * @details
+ * The update runs across channels without branches. Samples equal to
+ * @c RTD_CONVERSION_FAILED leave their channel unchanged, and the first valid sample of a
+ * channel only primes its reference.
+ *
+ * @param[in,out] detector     Detector.
+ * @param[in]     temperatures @c channel_count temperatures in degrees Celsius, one per channel.
+ * @param[out]    rise_mask    Optional bit mask receiving bit i set for every channel whose level
+ *                             has risen ((channel_count + 31) / 32 words). Pass @c NULL if not needed.
+ * @param[out]    fall_mask    Optional bit mask receiving bit i set for every channel whose level
+ *                             has fallen. Pass @c NULL if not needed.
+ *
+ * @return Number of change points in the frame.
+ */
+uint32_t RTD_ChangeDetector_Process(RTD_ChangeDetector_t *detector, const double *temperatures, uint32_t *rise_mask, uint32_t *fall_mask);
+
+/**
+ * @brief Updates the detector with a sequence of samples of arbitrary channels.
+ *
+ * @details
+ * Samples are applied in order, so a channel may appear several times. Samples of channels
+ * beyond @c channel_count, and samples equal to @c RTD_CONVERSION_FAILED, are ignored.
+ *
+ * @param[in,out] detector      Detector.
+ * @param[in]     channels      Channel number of each sample.
+ * @param[in]     temperatures  Temperature of each sample in degrees Celsius.
+ * @param[out]    changes       Optional change direction of each sample (@c RTD_CHANGE_x). Pass
+ *                              @c NULL if not needed.
+ * @param[in]     count         Number of samples.
+ *
+ * @return Number of change points among the samples.
+ */
+uint32_t RTD_ChangeDetector_Update(RTD_ChangeDetector_t *detector, const uint32_t *channels, const double *temperatures, uint8_t *changes,
+                                   uint32_t count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_diag.h */
@@ -0,0 +1,700 @@
+/**
+ * @file    platinum_rtd_filter.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Multi-channel smoothing filters for platinum RTD temperatures.
+ *
+ * @details
+ * This file implements the structure-of-arrays filters and the fused conversion and filtering
+ * stage declared in @c platinum_rtd_filter.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_filter.h"    ///< Header file for RTD filter functions.
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Applies a first-order IIR filter to a block of channels of one frame.
+ *
+ * @details
+ * Failed and unprimed samples are handled with 0/1 weights instead of selects: a weight of
+ * exactly 0 or 1 blends two finite values without rounding, and the loop stays free of the
+ * repeated conditions that prevent compilers from vectorizing it.
+ */
+static void RTD_Iir1Block(RTD_Iir1_t *filter, double *values, uint32_t first_channel, uint32_t count)
+{
+    uint32_t index = 0U;
+    double input = 0.0, previous = 0.0, base = 0.0, output = 0.0, take = 0.0, fresh = 0.0;
+    double alpha = filter->alpha;
+    double *state = &filter->state[first_channel];
+
+    for (index = 0U; index < count; index++)
+    {
+        input = values[index];
+        previous = state[index];
+        take = (input == RTD_CONVERSION_FAILED) ? 0.0 : 1.0;
+        fresh = (previous == RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+        base = (fresh * input) + ((1.0 - fresh) * previous);
+        output = base + ((take * alpha) * (input - base));
+        state[index] = output;
+        values[index] = (take * output) + ((1.0 - take) * input);
+    }
+}
+
+/**
+ * @brief Applies a biquad cascade to a block of channels of one frame.
+ *
+ * @details
+ * An unprimed section (first state variable equal to @c RTD_CONVERSION_FAILED) starts from the
+ * steady state of its input: s1 = (G - b0) x and s2 = (b2 - a2 G) x with the DC gain
+ * G = (b0 + b1 + b2) / (1 + a1 + a2). Failed samples keep the state through 0/1 weights, as in
+ * @c RTD_Iir1Block.
+ */
+static void RTD_BiquadBlock(RTD_Biquad_t *filter, double *values, uint32_t first_channel, uint32_t count)
+{
+    uint32_t section = 0U, index = 0U;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0, gain = 0.0;
+    double input = 0.0, source = 0.0, output = 0.0, state1 = 0.0, state2 = 0.0, take = 0.0, fresh = 0.0;
+    double *states1 = NULL, *states2 = NULL;
+    const double *coefficients = NULL;
+
+    for (section = 0U; section < filter->section_count; section++)
+    {
+        coefficients = &filter->coefficients[5U * section];
+        b0 = coefficients[0];
+        b1 = coefficients[1];
+        b2 = coefficients[2];
+        a1 = coefficients[3];
+        a2 = coefficients[4];
+        gain = (b0 + b1 + b2) / (1.0 + a1 + a2);
+        states1 = &filter->state[((size_t)(2U * section) * filter->channel_count) + first_channel];
+        states2 = &filter->state[((size_t)((2U * section) + 1U) * filter->channel_count) + first_channel];
+
+        for (index = 0U; index < count; index++)
+        {
+            input = values[index];
+            take = (input == RTD_CONVERSION_FAILED) ? 0.0 : 1.0;
+            fresh = (states1[index] == RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+            source = take * input;
+            state1 = (fresh * ((gain - b0) * source)) + ((1.0 - fresh) * states1[index]);
+            state2 = (fresh * ((b2 - (a2 * gain)) * source)) + ((1.0 - fresh) * states2[index]);
+            output = (b0 * source) + state1;
+            states1[index] = (take * ((b1 * source) - (a1 * output) + state2)) + ((1.0 - take) * states1[index]);
+            states2[index] = (take * ((b2 * source) - (a2 * output))) + ((1.0 - take) * states2[index]);
+            values[index] = (take * output) + ((1.0 - take) * input);
+        }
+    }
+}
+
+/**
+ * @brief Applies a Kalman filter to a block of at most @c RTD_FILTER_BLOCK_SIZE channels.
+ *
+ * @details
+ * Predict and update are written out for the 2x2 covariance. Unprimed channels take the
+ * measurement with its variance as their estimate; failed samples only run the prediction.
+ * Both cases use 0/1 weights, as in @c RTD_Iir1Block. The covariance and the state are updated
+ * in two loops that pass the gains through local arrays, which keeps the number of pointer
+ * streams per loop low enough for compilers to vectorize both.
+ */
+static void RTD_KalmanBlock(RTD_Kalman_t *filter, double *values, uint32_t first_channel, uint32_t count)
+{
+    uint32_t index = 0U;
+    double measured = 0.0, take = 0.0, fresh = 0.0, active_c = 0.0, sensitivity = 0.0, variance = 0.0;
+    double temperature = 0.0, rate = 0.0, p00 = 0.0, p01 = 0.0, p11 = 0.0, innovation = 0.0;
+    double interval = filter->interval;
+    double resistance_at_zero = filter->resistance_at_zero;
+    double resistance_variance = filter->resistance_variance;
+    double q00 = filter->process_noise * interval * interval * interval / 3.0;
+    double q01 = filter->process_noise * interval * interval / 2.0;
+    double q11 = filter->process_noise * interval;
+    double *temperatures = &filter->temperature[first_channel];
+    double *rates = &filter->rate[first_channel];
+    double *covariance00 = &filter->covariance[first_channel];
+    double *covariance01 = &filter->covariance[(size_t)filter->channel_count + first_channel];
+    double *covariance11 = &filter->covariance[((size_t)2U * filter->channel_count) + first_channel];
+    double gains0[RTD_FILTER_BLOCK_SIZE];
+    double gains1[RTD_FILTER_BLOCK_SIZE];
+
+    for (index = 0U; index < count; index++)
+    {
+        measured = values[index];
+        take = (measured == RTD_CONVERSION_FAILED) ? 0.0 : 1.0;
+        fresh = (temperatures[index] == RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+
+        /* Measurement variance in K^2: resistance variance divided by (dR/dT)^2 */
+        active_c = (measured < 0.0) ? RTD_C_COEFFICIENT : 0.0;
+        sensitivity = resistance_at_zero * (RTD_A_COEFFICIENT + measured * (2.0 * RTD_B_COEFFICIENT + active_c * measured * (4.0 * measured - 300.0)));
+        variance = resistance_variance / (sensitivity * sensitivity);
+
+        /* Predicted covariance, or the priming covariance */
+        p00 = (fresh * variance) + ((1.0 - fresh) * (covariance00[index] + (interval * (2.0 * covariance01[index] + interval * covariance11[index])) + q00));
+        p01 = (1.0 - fresh) * (covariance01[index] + (interval * covariance11[index]) + q01);
+        p11 = (fresh * RTD_KALMAN_INITIAL_RATE_VARIANCE) + ((1.0 - fresh) * (covariance11[index] + q11));
+
+        /* A priming or failed sample has zero gain */
+        gains0[index] = (take * (1.0 - fresh)) * (p00 / (p00 + variance));
+        gains1[index] = (take * (1.0 - fresh)) * (p01 / (p00 + variance));
+        covariance00[index] = (1.0 - gains0[index]) * p00;
+        covariance01[index] = (1.0 - gains0[index]) * p01;
+        covariance11[index] = p11 - (gains1[index] * p01);
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        measured = values[index];
+        take = (measured == RTD_CONVERSION_FAILED) ? 0.0 : 1.0;
+        fresh = (temperatures[index] == RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+        temperature = (fresh * measured) + ((1.0 - fresh) * (temperatures[index] + (interval * rates[index])));
+        rate = (1.0 - fresh) * rates[index];
+        innovation = measured - temperature;
+        temperatures[index] = temperature + (gains0[index] * innovation);
+        rates[index] = rate + (gains1[index] * innovation);
+        values[index] = (take * temperatures[index]) + ((1.0 - take) * measured);
+    }
+}
+
+/**
+ * @brief Applies lag compensation to a block of channels of one frame.
+ *
+ * @details
+ * An unprimed channel starts with input and output equal to its first valid sample, which is
+ * the steady state of the stage. Failed samples keep the state through 0/1 weights, as in
+ * @c RTD_Iir1Block.
+ */
+static void RTD_LagCompensatorBlock(RTD_LagCompensator_t *compensator, double *values, uint32_t first_channel, uint32_t count)
+{
+    uint32_t index = 0U;
+    double current = 0.0, previous_input = 0.0, previous_output = 0.0, output = 0.0, take = 0.0, fresh = 0.0;
+    double pole = compensator->pole;
+    double *inputs = &compensator->input[first_channel];
+    double *outputs = &compensator->output[first_channel];
+    const double *zeros = &compensator->zero[first_channel];
+    const double *gains = &compensator->gain[first_channel];
+
+    for (index = 0U; index < count; index++)
+    {
+        current = values[index];
+        take = (current == RTD_CONVERSION_FAILED) ? 0.0 : 1.0;
+        fresh = (inputs[index] == RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+        previous_input = (fresh * current) + ((1.0 - fresh) * inputs[index]);
+        previous_output = (fresh * current) + ((1.0 - fresh) * outputs[index]);
+        output = (pole * previous_output) + (gains[index] * (current - (zeros[index] * previous_input)));
+        inputs[index] = (take * current) + ((1.0 - take) * inputs[index]);
+        outputs[index] = (take * output) + ((1.0 - take) * outputs[index]);
+        values[index] = (take * output) + ((1.0 - take) * current);
+    }
+}
+
+/**
+ * @brief Applies a moving average to a block of channels of the current frame.
+ *
+ * @details
+ * The history row of the current frame is overwritten; @c RTD_AdvanceMovingAverage must be
+ * called once the whole frame has been processed. Rows written while a channel is unprimed hold
+ * 0, so they drop out of the window sum without being counted in its fill.
+ */
+static void RTD_MovingAverageBlock(RTD_MovingAverage_t *filter, double *values, uint32_t first_channel, uint32_t count)
+{
+    uint32_t index = 0U;
+    double input = 0.0, total = 0.0, depth = 0.0, next = 0.0, valid = 0.0;
+    const double length = (double)filter->length;
+    double *row = &filter->history[((size_t)filter->position * filter->channel_count) + first_channel];
+    double *sum = &filter->sum[first_channel];
+    double *fill = &filter->fill[first_channel];
+
+    for (index = 0U; index < count; index++)
+    {
+        valid = (values[index] != RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+        depth = fill[index];
+
+        /* A failed sample enters as the current average; while unprimed the sum and the input are 0 */
+        input = (valid != 0.0) ? values[index] : (sum[index] / ((depth > 1.0) ? depth : 1.0));
+        next = ((valid + depth) != 0.0) ? (depth + 1.0) : 0.0;
+        next = (next < length) ? next : length;
+        total = sum[index] + input - row[index];
+        sum[index] = total;
+        row[index] = input;
+        fill[index] = next;
+        values[index] = (valid != 0.0) ? (total / ((next > 1.0) ? next : 1.0)) : values[index];
+    }
+}
+
+/**
+ * @brief Moves a moving average to the next frame.
+ *
+ * @details
+ * The sums are recomputed from the history once per window so that rounding errors of the
+ * running update cannot accumulate.
+ */
+static void RTD_AdvanceMovingAverage(RTD_MovingAverage_t *filter)
+{
+    uint32_t row = 0U, channel = 0U;
+    const double *history = NULL;
+
+    filter->position++;
+
+    if (filter->position == filter->length)
+    {
+        filter->position = 0U;
+
+        for (channel = 0U; channel < filter->channel_count; channel++)
+        {
+            filter->sum[channel] = 0.0;
+        }
+
+        for (row = 0U; row < filter->length; row++)
+        {
+            history = &filter->history[(size_t)row * filter->channel_count];
+
+            for (channel = 0U; channel < filter->channel_count; channel++)
+            {
+                filter->sum[channel] += history[channel];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks that every stage of a filter chain has the given number of channels.
+ *
+ * @return 1 if all used stages match @p channel_count, 0 otherwise.
+ */
+static uint8_t RTD_FilterChainMatches(const RTD_FilterChain_t *chain, uint32_t channel_count)
+{
+    uint8_t is_valid = 1U;
+
+    is_valid &= (uint8_t)( (chain->iir == NULL) || (chain->iir->channel_count == channel_count) );
+    is_valid &= (uint8_t)( (chain->biquad == NULL) || (chain->biquad->channel_count == channel_count) );
+    is_valid &= (uint8_t)( (chain->moving_average == NULL) || (chain->moving_average->channel_count == channel_count) );
+    is_valid &= (uint8_t)( (chain->kalman == NULL) || (chain->kalman->channel_count == channel_count) );
+    is_valid &= (uint8_t)( (chain->lag == NULL) || (chain->lag->channel_count == channel_count) );
+
+    return is_valid;
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes an unprimed first-order IIR filter.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  state          Storage for @p channel_count outputs.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  alpha          Smoothing factor in the range (0, 1].
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Iir1_Init(RTD_Iir1_t *filter, double *state, uint32_t channel_count, double alpha)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+
+    if ( (filter != NULL) && (state != NULL) && (alpha > 0.0) && (alpha <= 1.0) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            state[channel] = RTD_CONVERSION_FAILED;
+        }
+
+        filter->state = state;
+        filter->channel_count = channel_count;
+        filter->alpha = alpha;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count temperatures, replaced by the filter outputs.
+ */
+void RTD_Iir1_Process(RTD_Iir1_t *filter, double *values)
+{
+    if ( (filter != NULL) && (values != NULL) )
+    {
+        RTD_Iir1Block(filter, values, 0U, filter->channel_count);
+    }
+}
+
+/**
+ * @brief Initializes an unprimed biquad cascade.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  state          Storage for 2 * @p section_count * @p channel_count state variables.
+ * @param[in]  coefficients   5 * @p section_count coefficients { b0, b1, b2, a1, a2 } per section;
+ *                            each section must have a nonzero DC gain denominator (1 + a1 + a2).
+ * @param[in]  section_count  Number of sections (>= 1).
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Biquad_Init(RTD_Biquad_t *filter, double *state, const double *coefficients, uint32_t section_count, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+    uint32_t section = 0U;
+    size_t index = 0U;
+
+    if ( (filter != NULL) && (state != NULL) && (coefficients != NULL) && (section_count != 0U) )
+    {
+        is_valid = 1U;
+
+        for (section = 0U; section < section_count; section++)
+        {
+            if ((1.0 + coefficients[(5U * section) + 3U] + coefficients[(5U * section) + 4U]) == 0.0)
+            {
+                is_valid = 0U;
+            }
+        }
+
+        if (is_valid != 0U)
+        {
+            for (index = 0U; index < ((size_t)2U * section_count * channel_count); index++)
+            {
+                state[index] = RTD_CONVERSION_FAILED;
+            }
+
+            filter->state = state;
+            filter->coefficients = coefficients;
+            filter->section_count = section_count;
+            filter->channel_count = channel_count;
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count temperatures, replaced by the filter outputs.
+ */
+void RTD_Biquad_Process(RTD_Biquad_t *filter, double *values)
+{
+    if ( (filter != NULL) && (values != NULL) )
+    {
+        RTD_BiquadBlock(filter, values, 0U, filter->channel_count);
+    }
+}
+
+/**
+ * @brief Initializes an empty moving average.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  history        Storage for @p length * @p channel_count samples.
+ * @param[in]  sum            Storage for @p channel_count sums.
+ * @param[in]  fill           Storage for @p channel_count window fills.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  length         Window length in frames (>= 1).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_MovingAverage_Init(RTD_MovingAverage_t *filter, double *history, double *sum, double *fill, uint32_t channel_count,
+                               uint32_t length)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+    size_t index = 0U;
+
+    if ( (filter != NULL) && (history != NULL) && (sum != NULL) && (fill != NULL) && (length != 0U) )
+    {
+        for (index = 0U; index < ((size_t)length * channel_count); index++)
+        {
+            history[index] = 0.0;
+        }
+
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            sum[channel] = 0.0;
+            fill[channel] = 0.0;
+        }
+
+        filter->history = history;
+        filter->sum = sum;
+        filter->fill = fill;
+        filter->channel_count = channel_count;
+        filter->length = length;
+        filter->position = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @details
+ * The first valid sample of a channel primes it; failed samples before it are skipped. Until
+ * @c length frames have been seen since priming, the average of a channel runs over the frames
+ * received so far. A failed sample of a primed channel enters the window as the current average
+ * of its channel.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count temperatures, replaced by the filter outputs.
+ */
+void RTD_MovingAverage_Process(RTD_MovingAverage_t *filter, double *values)
+{
+    if ( (filter != NULL) && (values != NULL) )
+    {
+        RTD_MovingAverageBlock(filter, values, 0U, filter->channel_count);
+        RTD_AdvanceMovingAverage(filter);
+    }
+}
+
+/**
+ * @brief Initializes an unprimed Kalman filter.
+ *
+ * @param[out] filter               Filter to initialize.
+ * @param[in]  sensor_type          The RTD sensor type of all channels.
+ * @param[in]  temperature          Storage for @p channel_count temperature estimates.
+ * @param[in]  rate                 Storage for @p channel_count rate estimates.
+ * @param[in]  covariance           Storage for 3 * @p channel_count covariance elements.
+ * @param[in]  channel_count        Number of channels.
+ * @param[in]  interval             Sample interval in seconds (> 0).
+ * @param[in]  process_noise        Acceleration noise spectral density in K^2/s^3 (>= 0).
+ * @param[in]  resistance_variance  Variance of the measured resistance in ohms^2 (> 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Kalman_Init(RTD_Kalman_t *filter, uint16_t sensor_type, double *temperature, double *rate, double *covariance,
+                        uint32_t channel_count, double interval, double process_noise, double resistance_variance)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+    size_t index = 0U;
+    double resistance_at_zero = RTD_CalculateResistance(sensor_type, 0.0);
+
+    if ( (filter != NULL) && (temperature != NULL) && (rate != NULL) && (covariance != NULL) && (interval > 0.0) &&
+         (process_noise >= 0.0) && (resistance_variance > 0.0) && (resistance_at_zero != RTD_CONVERSION_FAILED) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            temperature[channel] = RTD_CONVERSION_FAILED;
+            rate[channel] = 0.0;
+        }
+
+        for (index = 0U; index < ((size_t)3U * channel_count); index++)
+        {
+            covariance[index] = 0.0;
+        }
+
+        filter->temperature = temperature;
+        filter->rate = rate;
+        filter->covariance = covariance;
+        filter->channel_count = channel_count;
+        filter->resistance_at_zero = resistance_at_zero;
+        filter->interval = interval;
+        filter->process_noise = process_noise;
+        filter->resistance_variance = resistance_variance;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @details
+ * The first valid sample of a channel primes its estimate with zero rate. The rate estimates are
+ * available in @c filter->rate after the call.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count measured temperatures, replaced by the estimates.
+ */
+void RTD_Kalman_Process(RTD_Kalman_t *filter, double *values)
+{
+    uint32_t first = 0U, count = 0U;
+
+    if ( (filter != NULL) && (values != NULL) )
+    {
+        for (first = 0U; first < filter->channel_count; first += count)
+        {
+            count = filter->channel_count - first;
+            count = (count < RTD_FILTER_BLOCK_SIZE) ? count : RTD_FILTER_BLOCK_SIZE;
+            RTD_KalmanBlock(filter, &values[first], first, count);
+        }
+    }
+}
+
+/**
+ * @brief Initializes an unprimed thermal lag compensator.
+ *
+ * @param[out] compensator           Compensator to initialize.
+ * @param[in]  input                 Storage for @p channel_count previous inputs.
+ * @param[in]  output                Storage for @p channel_count previous outputs.
+ * @param[in]  zero                  Storage for @p channel_count zeros.
+ * @param[in]  gain                  Storage for @p channel_count gains.
+ * @param[in]  time_constants        Sensor time constant of each channel in seconds (>= 0).
+ * @param[in]  channel_count         Number of channels.
+ * @param[in]  interval              Sample interval in seconds (> 0).
+ * @param[in]  filter_time_constant  Time constant of the compensated response in seconds (> 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_LagCompensator_Init(RTD_LagCompensator_t *compensator, double *input, double *output, double *zero, double *gain,
+                                const double *time_constants, uint32_t channel_count, double interval, double filter_time_constant)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+
+    if ( (compensator != NULL) && (input != NULL) && (output != NULL) && (zero != NULL) && (gain != NULL) &&
+         (time_constants != NULL) && (interval > 0.0) && (filter_time_constant > 0.0) )
+    {
+        compensator->input = input;
+        compensator->output = output;
+        compensator->zero = zero;
+        compensator->gain = gain;
+        compensator->channel_count = channel_count;
+        compensator->interval = interval;
+        compensator->pole = exp(-interval / filter_time_constant);
+        is_valid = 1U;
+
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            input[channel] = RTD_CONVERSION_FAILED;
+            output[channel] = RTD_CONVERSION_FAILED;
+            is_valid &= RTD_LagCompensator_SetChannel(compensator, channel, time_constants[channel]);
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Sets the sensor time constant of a channel.
+ *
+ * @details
+ * The state of the channel is kept, so a time constant can be retuned while running.
+ *
+ * @param[in,out] compensator    Compensator.
+ * @param[in]     channel        Channel number.
+ * @param[in]     time_constant  Sensor time constant in seconds (>= 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_LagCompensator_SetChannel(RTD_LagCompensator_t *compensator, uint32_t channel, double time_constant)
+{
+    uint8_t is_valid = 0U;
+    double zero = 0.0;
+
+    if ( (compensator != NULL) && (channel < compensator->channel_count) && (time_constant >= 0.0) )
+    {
+        /* A zero time constant gives a zero of 0, i.e. a plain low-pass with filter_time_constant */
+        zero = (time_constant > 0.0) ? exp(-compensator->interval / time_constant) : 0.0;
+        compensator->zero[channel] = zero;
+        compensator->gain[channel] = (1.0 - compensator->pole) / (1.0 - zero);
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Compensates one frame of temperatures in place.
+ *
+ * @details
+ * The first valid sample of a channel primes it in steady state.
+ *
+ * @param[in,out] compensator  Compensator.
+ * @param[in,out] values       @c channel_count temperatures, replaced by the compensated values.
+ */
+void RTD_LagCompensator_Process(RTD_LagCompensator_t *compensator, double *values)
+{
+    if ( (compensator != NULL) && (values != NULL) )
+    {
+        RTD_LagCompensatorBlock(compensator, values, 0U, compensator->channel_count);
+    }
+}
+
+/**
+ * @brief Converts resistance frames and applies a filter chain in one pass.
+ *
+ * @details
+ * Each frame is processed in blocks of @c RTD_FILTER_BLOCK_SIZE channels: the block is converted
+ * with the batch kernel and then passed through the lag compensation, Kalman, IIR, biquad and
+ * moving-average stages of @p chain, in that order, while it is still in cache. All stages of
+ * the chain must have @p channel_count channels; otherwise nothing is processed.
+ *
+ * @param[in]     sensor_type    The RTD sensor type of all channels.
+ * @param[in,out] chain          Filter chain.
+ * @param[in]     resistances    @p frame_count frames of @p channel_count resistances in ohms.
+ * @param[out]    temperatures   @p frame_count frames of @p channel_count filtered temperatures.
+ * @param[in]     frame_count    Number of frames.
+ * @param[in]     channel_count  Number of channels per frame.
+ *
+ * @return Number of samples converted successfully (0 if a stage has a different channel count).
+ */
+uint32_t RTD_Filter_ConvertFrames(uint16_t sensor_type, RTD_FilterChain_t *chain, const double *resistances, double *temperatures,
+                                  uint32_t frame_count, uint32_t channel_count)
+{
+    uint32_t frame = 0U, first = 0U, count = 0U, converted = 0U;
+    const double *frame_resistances = NULL;
+    double *frame_temperatures = NULL;
+
+    if ( (chain != NULL) && (resistances != NULL) && (temperatures != NULL) && (RTD_FilterChainMatches(chain, channel_count) != 0U) )
+    {
+        for (frame = 0U; frame < frame_count; frame++)
+        {
+            frame_resistances = &resistances[(size_t)frame * channel_count];
+            frame_temperatures = &temperatures[(size_t)frame * channel_count];
+
+            for (first = 0U; first < channel_count; first += count)
+            {
+                count = channel_count - first;
+                count = (count < RTD_FILTER_BLOCK_SIZE) ? count : RTD_FILTER_BLOCK_SIZE;
+                converted += RTD_CalculateTemperatureBatch(sensor_type, &frame_resistances[first], &frame_temperatures[first], count);
+
+                if (chain->lag != NULL)
+                {
+                    RTD_LagCompensatorBlock(chain->lag, &frame_temperatures[first], first, count);
+                }
+
+                if (chain->kalman != NULL)
+                {
+                    RTD_KalmanBlock(chain->kalman, &frame_temperatures[first], first, count);
+                }
+
+                if (chain->iir != NULL)
+                {
+                    RTD_Iir1Block(chain->iir, &frame_temperatures[first], first, count);
+                }
+
+                if (chain->biquad != NULL)
+                {
+                    RTD_BiquadBlock(chain->biquad, &frame_temperatures[first], first, count);
+                }
+
+                if (chain->moving_average != NULL)
+                {
+                    RTD_MovingAverageBlock(chain->moving_average, &frame_temperatures[first], first, count);
+                }
+            }
+
+            if (chain->moving_average != NULL)
+            {
+                RTD_AdvanceMovingAverage(chain->moving_average);
+            }
+        }
+    }
+
+    return converted;
+}
+
+
+/* platinum_rtd_filter.c */
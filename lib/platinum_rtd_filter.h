@@ -0,0 +1,320 @@
+/**
+ * @file    platinum_rtd_filter.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Multi-channel smoothing filters for platinum RTD temperatures.
+ *
+ * @details
+ * This file provides first-order IIR, biquad cascade, moving-average and two-state Kalman
+ * (temperature and rate) filters that run across channels of one frame at a time, and a
+ * lead-lag stage that compensates the thermal lag of sheathed sensors. The
+ * per-channel state of every filter is kept in structure-of-arrays form, so each filter step is
+ * a unit-stride loop over channels that compilers vectorize. @c RTD_Filter_ConvertFrames fuses
+ * batch conversion with a filter chain block by block, so each resistance frame is read from
+ * memory once and filtered while it is still in cache.
+ *
+ * Every filter starts unprimed and takes the first valid sample of a channel as its initial
+ * steady state. A sample equal to @c RTD_CONVERSION_FAILED is passed through unchanged and does not
+ * disturb the state of IIR, biquad, Kalman and lag compensation stages.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_FILTER_H
+#define _PLATINUM_RTD_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Number of channels converted and filtered together by @c RTD_Filter_ConvertFrames */
+#ifndef RTD_FILTER_BLOCK_SIZE
+#define  RTD_FILTER_BLOCK_SIZE  256U    /**< 2 KiB of input and 2 KiB of output per block */
+#endif
+
+
+/** @brief Rate variance assigned to a Kalman channel when it is primed by its first sample */
+#ifndef RTD_KALMAN_INITIAL_RATE_VARIANCE
+#define  RTD_KALMAN_INITIAL_RATE_VARIANCE  1.0    /**< (K/s)^2 */
+#endif
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/** @brief First-order IIR low-pass filter, y += alpha (x - y), for all channels. */
+typedef struct
+{
+    double *state;             /**< Filter output of each channel (unprimed: @c RTD_CONVERSION_FAILED) */
+    uint32_t channel_count;    /**< Number of channels                                              */
+    double alpha;              /**< Smoothing factor in the range (0, 1]                            */
+} RTD_Iir1_t;
+
+/**
+ * @brief Cascade of biquad sections (direct form II transposed) for all channels.
+ *
+ * @details
+ * Section s uses coefficients[5 s .. 5 s + 4] = { b0, b1, b2, a1, a2 } with a0 = 1. Its two
+ * state variables of channel c are state[(2 s) channel_count + c] and
+ * state[(2 s + 1) channel_count + c].
+ */
+typedef struct
+{
+    double *state;                /**< 2 * section_count * channel_count state variables  */
+    const double *coefficients;   /**< 5 * section_count coefficients                      */
+    uint32_t section_count;       /**< Number of biquad sections                           */
+    uint32_t channel_count;       /**< Number of channels                                  */
+} RTD_Biquad_t;
+
+/** @brief Moving average over the last @c length frames of all channels. */
+typedef struct
+{
+    double *history;           /**< length * channel_count samples, one frame per row  */
+    double *sum;               /**< Sum of the history of each channel                 */
+    double *fill;              /**< Frames in the window of each channel (unprimed: 0) */
+    uint32_t channel_count;    /**< Number of channels                                 */
+    uint32_t length;           /**< Window length in frames                            */
+    uint32_t position;         /**< History row written by the next frame              */
+} RTD_MovingAverage_t;
+
+/**
+ * @brief Two-state (temperature, rate) Kalman filter for all channels (structure-of-arrays).
+ *
+ * @details
+ * Constant-rate model with white acceleration noise of spectral density @c process_noise. The
+ * measurement variance of each sample is @c resistance_variance / S^2, where S = dR/dT is the
+ * sensitivity at the measured temperature, so the noise model follows the strongly varying slope
+ * of the Callendar–Van Dusen curve. Covariance element P_ij of channel c is covariance[k n + c]
+ * with k = 0, 1, 2 for P00, P01, P11 and n = channel_count.
+ */
+typedef struct
+{
+    double *temperature;           /**< Estimated temperature (unprimed: @c RTD_CONVERSION_FAILED)   */
+    double *rate;                  /**< Estimated rate of change (K/s)                              */
+    double *covariance;            /**< 3 * channel_count covariance elements                       */
+    uint32_t channel_count;        /**< Number of channels                                          */
+    double resistance_at_zero;     /**< R0 of the sensor type (ohms)                                */
+    double interval;               /**< Sample interval (s)                                         */
+    double process_noise;          /**< Acceleration noise spectral density (K^2/s^3)               */
+    double resistance_variance;    /**< Variance of the measured resistance (ohms^2)                */
+} RTD_Kalman_t;
+
+/**
+ * @brief First-order thermal lag compensation for all channels (structure-of-arrays).
+ *
+ * @details
+ * A sheathed sensor follows the process temperature like a first-order low-pass with time
+ * constant tau_c. The stage applies the lead-lag y[n] = pole y[n-1] + gain (x[n] - zero x[n-1]),
+ * whose zero exp(-interval / tau_c) cancels the sensor pole and whose pole
+ * exp(-interval / filter_time_constant) limits the amplification of noise. The step response
+ * of sensor and stage together has the time constant @c filter_time_constant instead of tau_c,
+ * and the DC gain is 1.
+ */
+typedef struct
+{
+    double *input;              /**< Previous input of each channel (unprimed: @c RTD_CONVERSION_FAILED) */
+    double *output;             /**< Previous output of each channel                                    */
+    double *zero;               /**< exp(-interval / tau_c) of each channel                             */
+    double *gain;               /**< (1 - pole) / (1 - zero) of each channel                            */
+    uint32_t channel_count;     /**< Number of channels                                                 */
+    double interval;            /**< Sample interval (s)                                                */
+    double pole;                /**< exp(-interval / filter_time_constant)                              */
+} RTD_LagCompensator_t;
+
+/** @brief Filters applied in order by @c RTD_Filter_ConvertFrames (unused filters are @c NULL). */
+typedef struct
+{
+    RTD_Iir1_t *iir;                         /**< Optional first-order IIR      */
+    RTD_Biquad_t *biquad;                    /**< Optional biquad cascade       */
+    RTD_MovingAverage_t *moving_average;     /**< Optional moving average       */
+    RTD_Kalman_t *kalman;                    /**< Optional Kalman filter        */
+    RTD_LagCompensator_t *lag;               /**< Optional lag compensation     */
+} RTD_FilterChain_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes an unprimed first-order IIR filter.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  state          Storage for @p channel_count outputs.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  alpha          Smoothing factor in the range (0, 1].
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Iir1_Init(RTD_Iir1_t *filter, double *state, uint32_t channel_count, double alpha);
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count temperatures, replaced by the filter outputs.
+ */
+void RTD_Iir1_Process(RTD_Iir1_t *filter, double *values);
+
+/**
+ * @brief Initializes an unprimed biquad cascade.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  state          Storage for 2 * @p section_count * @p channel_count state variables.
+ * @param[in]  coefficients   5 * @p section_count coefficients { b0, b1, b2, a1, a2 } per section;
+ *                            each section must have a nonzero DC gain denominator (1 + a1 + a2).
+ * @param[in]  section_count  Number of sections (>= 1).
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Biquad_Init(RTD_Biquad_t *filter, double *state, const double *coefficients, uint32_t section_count, uint32_t channel_count);
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count temperatures, replaced by the filter outputs.
+ */
+void RTD_Biquad_Process(RTD_Biquad_t *filter, double *values);
+
+/**
+ * @brief Initializes an empty moving average.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  history        Storage for @p length * @p channel_count samples.
+ * @param[in]  sum            Storage for @p channel_count sums.
+ * @param[in]  fill           Storage for @p channel_count window fills.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  length         Window length in frames (>= 1).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_MovingAverage_Init(RTD_MovingAverage_t *filter, double *history, double *sum, double *fill, uint32_t channel_count,
+                               uint32_t length);
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @details
+ * The first valid sample of a channel primes it; failed samples before it are skipped. Until
+ * @c length frames have been seen since priming, the average of a channel runs over the frames
+ * received so far. A failed sample of a primed channel enters the window as the current average
+ * of its channel.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count temperatures, replaced by the filter outputs.
+ */
+void RTD_MovingAverage_Process(RTD_MovingAverage_t *filter, double *values);
+
+/**
+ * @brief Initializes an unprimed Kalman filter.
+ *
+ * @param[out] filter               Filter to initialize.
+ * @param[in]  sensor_type          The RTD sensor type of all channels.
+ * @param[in]  temperature          Storage for @p channel_count temperature estimates.
+ * @param[in]  rate                 Storage for @p channel_count rate estimates.
+ * @param[in]  covariance           Storage for 3 * @p channel_count covariance elements.
+ * @param[in]  channel_count        Number of channels.
+ * @param[in]  interval             Sample interval in seconds (> 0).
+ * @param[in]  process_noise        Acceleration noise spectral density in K^2/s^3 (>= 0).
+ * @param[in]  resistance_variance  Variance of the measured resistance in ohms^2 (> 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Kalman_Init(RTD_Kalman_t *filter, uint16_t sensor_type, double *temperature, double *rate, double *covariance,
+                        uint32_t channel_count, double interval, double process_noise, double resistance_variance);
+
+/**
+ * @brief Filters one frame of temperatures in place.
+ *
+ * @details
+ * The first valid sample of a channel primes its estimate with zero rate. The rate estimates are
+ * available in @c filter->rate after the call.
+ *
+ * @param[in,out] filter  Filter.
+ * @param[in,out] values  @c channel_count measured temperatures, replaced by the estimates.
+ */
+void RTD_Kalman_Process(RTD_Kalman_t *filter, double *values);
+
+/**
+ * @brief Initializes an unprimed thermal lag compensator.
+ *
+ * @param[out] compensator           Compensator to initialize.
+ * @param[in]  input                 Storage for @p channel_count previous inputs.
+ * @param[in]  output                Storage for @p channel_count previous outputs.
+ * @param[in]  zero                  Storage for @p channel_count zeros.
+ * @param[in]  gain                  Storage for @p channel_count gains.
+ * @param[in]  time_constants        Sensor time constant of each channel in seconds (>= 0).
+ * @param[in]  channel_count         Number of channels.
+ * @param[in]  interval              Sample interval in seconds (> 0).
+ * @param[in]  filter_time_constant  Time constant of the compensated response in seconds (> 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_LagCompensator_Init(RTD_LagCompensator_t *compensator, double *input, double *output, double *zero, double *gain,
+                                const double *time_constants, uint32_t channel_count, double interval, double filter_time_constant);
+
+/**
+ * @brief Sets the sensor time constant of a channel.
+ *
+ * @details
+ * The state of the channel is kept, so a time constant can be retuned while running.
+ *
+ * @param[in,out] compensator    Compensator.
+ * @param[in]     channel        Channel number.
+ * @param[in]     time_constant  Sensor time constant in seconds (>= 0).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_LagCompensator_SetChannel(RTD_LagCompensator_t *compensator, uint32_t channel, double time_constant);
+
+/**
+ * @brief Compensates one frame of temperatures in place.
+ *
+ * @details
+ * The first valid sample of a channel primes it in steady state.
+ *
+ * @param[in,out] compensator  Compensator.
+ * @param[in,out] values       @c channel_count temperatures, replaced by the compensated values.
+ */
+void RTD_LagCompensator_Process(RTD_LagCompensator_t *compensator, double *values);
+
+/**
+ * @brief Converts resistance frames and applies a filter chain in one pass.
+ *
+ * @details
+ * Each frame is processed in blocks of @c RTD_FILTER_BLOCK_SIZE channels: the block is converted
+ * with the batch kernel and then passed through the lag compensation, Kalman, IIR, biquad and
+ * moving-average stages of @p chain, in that order, while it is still in cache. All stages of
+ * the chain must have @p channel_count channels; otherwise nothing is processed.
+ *
+ * @param[in]     sensor_type    The RTD sensor type of all channels.
+ * @param[in,out] chain          Filter chain.
+ * @param[in]     resistances    @p frame_count frames of @p channel_count resistances in ohms.
+ * @param[out]    temperatures   @p frame_count frames of @p channel_count filtered temperatures.
+ * @param[in]     frame_count    Number of frames.
+ * @param[in]     channel_count  Number of channels per frame.
+ *
+ * @return Number of samples converted successfully (0 if a stage has a different channel count).
+ */
+uint32_t RTD_Filter_ConvertFrames(uint16_t sensor_type, RTD_FilterChain_t *chain, const double *resistances, double *temperatures,
+                                  uint32_t frame_count, uint32_t channel_count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_filter.h */
@@ -0,0 +1,176 @@
+/**
+ * @file    platinum_rtd_heatmeter.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Paired-sensor temperature differences and energy integration for heat meters.
+ *
+ * @details
+ * This file implements the heat meter functions declared in @c platinum_rtd_heatmeter.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_heatmeter.h"    ///< Header file for RTD heat meter functions.
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Sensor pairs processed per block (stack use ~1 KiB) */
+#define  RTD_HEATMETER_BLOCK_SIZE  64U
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Calculates the temperature differences of one block of sensor pairs.
+ *
+ * @details
+ * Both temperatures come from the batch kernel and only set the slope of the chord between
+ * them. The C term uses the polynomial divided difference when both temperatures are on the
+ * same branch of the curve, and the plain difference quotient when they straddle 0°C, where
+ * the two temperatures cannot be close.
+ *
+ * @return Number of differences calculated successfully.
+ */
+static uint32_t RTD_DifferenceBlock(uint16_t sensor_type, double resistance_at_zero, const double *supply_resistances,
+                                    const double *return_resistances, double *differences, uint32_t count)
+{
+    uint32_t index = 0U, calculated = 0U;
+    double supply = 0.0, return_ = 0.0, valid = 0.0, c_supply = 0.0, c_return = 0.0, same = 0.0;
+    double polynomial = 0.0, quotient = 0.0, slope = 0.0, difference = 0.0;
+    double supply_temperatures[RTD_HEATMETER_BLOCK_SIZE];
+    double return_temperatures[RTD_HEATMETER_BLOCK_SIZE];
+
+    (void)RTD_CalculateTemperatureBatch(sensor_type, supply_resistances, supply_temperatures, count);
+    (void)RTD_CalculateTemperatureBatch(sensor_type, return_resistances, return_temperatures, count);
+
+    for (index = 0U; index < count; index++)
+    {
+        /* Failed pairs are evaluated at 0°C with 0/1 weights, which keeps the loop free of branches */
+        valid = ((supply_temperatures[index] != RTD_CONVERSION_FAILED) && (return_temperatures[index] != RTD_CONVERSION_FAILED)) ? 1.0 : 0.0;
+        supply = valid * supply_temperatures[index];
+        return_ = valid * return_temperatures[index];
+        c_supply = (supply < 0.0) ? RTD_C_COEFFICIENT : 0.0;
+        c_return = (return_ < 0.0) ? RTD_C_COEFFICIENT : 0.0;
+        same = (c_supply == c_return) ? 1.0 : 0.0;
+
+        /* Divided difference of T^3 (T - 100), and the difference quotient across 0°C; on the same
+           branch the quotient divides by 1, since supply - return may be any value there */
+        polynomial = ((supply + return_) * ((supply * supply) + (return_ * return_))) -
+                     (100.0 * ((supply * supply) + (supply * return_) + (return_ * return_)));
+        quotient = ((c_supply * supply * supply * supply * (supply - 100.0)) - (c_return * return_ * return_ * return_ * (return_ - 100.0))) /
+                   (same + ((1.0 - same) * (supply - return_)));
+        slope = RTD_A_COEFFICIENT + (RTD_B_COEFFICIENT * (supply + return_)) + (same * c_supply * polynomial) + ((1.0 - same) * quotient);
+        difference = ((supply_resistances[index] - return_resistances[index]) / resistance_at_zero) / slope;
+
+        differences[index] = (valid * difference) + ((1.0 - valid) * RTD_CONVERSION_FAILED);
+        calculated += (uint32_t)valid;
+    }
+
+    return calculated;
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Calculates supply/return temperature differences of matched sensor pairs.
+ *
+ * @param[in]  sensor_type          The RTD sensor type of both sensors (e.g. @c RTD_SENSOR_PT500).
+ * @param[in]  supply_resistances   Supply (flow) sensor resistances in ohms.
+ * @param[in]  return_resistances   Return sensor resistances in ohms.
+ * @param[out] differences          Supply minus return temperature in kelvin. Elements with
+ *                                  either resistance out of range are set to
+ *                                  @c RTD_CONVERSION_FAILED.
+ * @param[in]  count                Number of sensor pairs.
+ *
+ * @return Number of differences calculated successfully.
+ */
+uint32_t RTD_HeatMeter_CalculateDifference(uint16_t sensor_type, const double *supply_resistances, const double *return_resistances,
+                                           double *differences, uint32_t count)
+{
+    uint32_t first = 0U, length = 0U, calculated = 0U;
+    double resistance_at_zero = RTD_CalculateResistance(sensor_type, 0.0);
+
+    if ( (supply_resistances != NULL) && (return_resistances != NULL) && (differences != NULL) )
+    {
+        for (first = 0U; first < count; first += length)
+        {
+            length = ((count - first) < RTD_HEATMETER_BLOCK_SIZE) ? (count - first) : RTD_HEATMETER_BLOCK_SIZE;
+            calculated += RTD_DifferenceBlock(sensor_type, resistance_at_zero, &supply_resistances[first], &return_resistances[first],
+                                              &differences[first], length);
+        }
+    }
+
+    return calculated;
+}
+
+/**
+ * @brief Calculates the thermal energy of measurement intervals.
+ *
+ * @details
+ * Element i is one interval: its energy is k[i] V[i] dT[i], with dT from the sensor pair as in
+ * @c RTD_HeatMeter_CalculateDifference. The heat coefficient k (EN 1434, a function of the
+ * supply and return temperature and pressure) is supplied per interval, so its units set the
+ * units of the energy (e.g. kWh / (m^3 K) with V in m^3 gives kWh).
+ *
+ * @param[in]  sensor_type          The RTD sensor type of both sensors.
+ * @param[in]  supply_resistances   Supply sensor resistance of each interval in ohms.
+ * @param[in]  return_resistances   Return sensor resistance of each interval in ohms.
+ * @param[in]  volumes              Volume passed during each interval.
+ * @param[in]  heat_coefficients    Heat coefficient of each interval.
+ * @param[out] energies             Energy of each interval; 0 if a resistance is out of range.
+ * @param[out] differences          Optional temperature difference of each interval in kelvin
+ *                                  (@c RTD_CONVERSION_FAILED if out of range). Pass @c NULL
+ *                                  if not needed.
+ * @param[in]  count                Number of intervals.
+ *
+ * @return Number of intervals calculated successfully.
+ */
+uint32_t RTD_HeatMeter_CalculateEnergy(uint16_t sensor_type, const double *supply_resistances, const double *return_resistances,
+                                       const double *volumes, const double *heat_coefficients, double *energies,
+                                       double *differences, uint32_t count)
+{
+    uint32_t first = 0U, length = 0U, index = 0U, calculated = 0U;
+    double resistance_at_zero = RTD_CalculateResistance(sensor_type, 0.0);
+    double difference = 0.0, valid = 0.0;
+    double scratch[RTD_HEATMETER_BLOCK_SIZE];
+    const double *block_volumes = NULL, *block_coefficients = NULL;
+    double *block_differences = NULL, *block_energies = NULL;
+
+    if ( (supply_resistances != NULL) && (return_resistances != NULL) && (volumes != NULL) && (heat_coefficients != NULL) &&
+         (energies != NULL) )
+    {
+        for (first = 0U; first < count; first += length)
+        {
+            length = ((count - first) < RTD_HEATMETER_BLOCK_SIZE) ? (count - first) : RTD_HEATMETER_BLOCK_SIZE;
+
+            /* Differences go straight to the caller's array when it is requested */
+            block_differences = (differences != NULL) ? &differences[first] : scratch;
+            calculated += RTD_DifferenceBlock(sensor_type, resistance_at_zero, &supply_resistances[first], &return_resistances[first],
+                                              block_differences, length);
+            block_volumes = &volumes[first];
+            block_coefficients = &heat_coefficients[first];
+            block_energies = &energies[first];
+
+            for (index = 0U; index < length; index++)
+            {
+                difference = block_differences[index];
+                valid = (difference != RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+                block_energies[index] = valid * block_coefficients[index] * block_volumes[index] * difference;
+            }
+        }
+    }
+
+    return calculated;
+}
+
+
+/* platinum_rtd_heatmeter.c */
@@ -0,0 +1,94 @@
+/**
+ * @file    platinum_rtd_heatmeter.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Paired-sensor temperature differences and energy integration for heat meters.
+ *
+ * @details
+ * Heat meters (EN 1434) measure supply and return temperature with a matched sensor pair and
+ * need the difference far more accurately than either temperature. Subtracting two converted
+ * temperatures loses the small difference in the rounding and solver tolerance of both. This
+ * file computes it from the resistance difference instead:
+ *
+ *     dT = ((R1 - R2) / R0) / (A + B (T1 + T2) + C D(T1, T2))
+ *
+ * where the denominator is the divided difference of the normalized Callendar–Van Dusen curve
+ * and D is the divided difference of T^3 (T - 100). The temperatures enter only through the
+ * slope, so their errors reach dT scaled by about B dT / A (below 1e-5 relative for a 50 K
+ * difference), and a zero resistance difference gives exactly zero.
+ *
+ * All functions work on arrays of meters or intervals in blocks that stay in cache, so a fleet's
+ * interval data is processed in one pass.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_HEATMETER_H
+#define _PLATINUM_RTD_HEATMETER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Calculates supply/return temperature differences of matched sensor pairs.
+ *
+ * @param[in]  sensor_type          The RTD sensor type of both sensors (e.g. @c RTD_SENSOR_PT500).
+ * @param[in]  supply_resistances   Supply (flow) sensor resistances in ohms.
+ * @param[in]  return_resistances   Return sensor resistances in ohms.
+ * @param[out] differences          Supply minus return temperature in kelvin. Elements with
+ *                                  either resistance out of range are set to
+ *                                  @c RTD_CONVERSION_FAILED.
+ * @param[in]  count                Number of sensor pairs.
+ *
+ * @return Number of differences calculated successfully.
+ */
+uint32_t RTD_HeatMeter_CalculateDifference(uint16_t sensor_type, const double *supply_resistances, const double *return_resistances,
+                                           double *differences, uint32_t count);
+
+/**
+ * @brief Calculates the thermal energy of measurement intervals.
+ *
+ * @details
+ * Element i is one interval: its energy is k[i] V[i] dT[i], with dT from the sensor pair as in
+ * @c RTD_HeatMeter_CalculateDifference. The heat coefficient k (EN 1434, a function of the
+ * supply and return temperature and pressure) is supplied per interval, so its units set the
+ * units of the energy (e.g. kWh / (m^3 K) with V in m^3 gives kWh).
+ *
+ * @param[in]  sensor_type          The RTD sensor type of both sensors.
+ * @param[in]  supply_resistances   Supply sensor resistance of each interval in ohms.
+ * @param[in]  return_resistances   Return sensor resistance of each interval in ohms.
+ * @param[in]  volumes              Volume passed during each interval.
+ * @param[in]  heat_coefficients    Heat coefficient of each interval.
+ * @param[out] energies             Energy of each interval; 0 if a resistance is out of range.
+ * @param[out] differences          Optional temperature difference of each interval in kelvin
+ *                                  (@c RTD_CONVERSION_FAILED if out of range). Pass @c NULL
+ *                                  if not needed.
+ * @param[in]  count                Number of intervals.
+ *
+ * @return Number of intervals calculated successfully.
+ */
+uint32_t RTD_HeatMeter_CalculateEnergy(uint16_t sensor_type, const double *supply_resistances, const double *return_resistances,
+                                       const double *volumes, const double *heat_coefficients, double *energies,
+                                       double *differences, uint32_t count);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_heatmeter.h */
@@ -0,0 +1,478 @@
+/**
+ * @file    platinum_rtd_prefilter.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Resistance-domain pre-filtering stages for platinum RTD acquisition.
+ *
+ * @details
+ * This file implements the pre-filtering stages declared in @c platinum_rtd_prefilter.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_prefilter.h"    ///< Header file for RTD pre-filtering functions.
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  RTD_HAMPEL_BLOCK_SIZE  32U         /**< Channels per sorting block (2.3 KiB of stack per window matrix) */
+#define  RTD_MAD_SCALE          1.4826      /**< MAD to standard deviation for normally distributed noise */
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Completes the current window of a decimator into one output frame.
+ *
+ * @details
+ * The mean resistance of every channel is converted with the batch kernel. With curvature
+ * correction, T''(R) var(R) / 2 is added, where T''(R) = -R''(T) / R'(T)^3.
+ */
+static void RTD_CompleteWindow(RTD_Decimator_t *decimator, double *temperatures)
+{
+    uint32_t channel = 0U;
+    double scale = 1.0 / (double)decimator->phase;
+    double mean_deviation = 0.0, sensitivity = 0.0, curvature = 0.0, temperature = 0.0, active_c = 0.0;
+
+    for (channel = 0U; channel < decimator->channel_count; channel++)
+    {
+        mean_deviation = decimator->sum[channel] * scale;
+        temperatures[channel] = decimator->reference[channel] + mean_deviation;
+
+        /* The variance replaces the sum of squares until the window is reset */
+        decimator->sum_squares[channel] = (decimator->sum_squares[channel] * scale) - (mean_deviation * mean_deviation);
+        decimator->sum[channel] = 0.0;
+    }
+
+    (void)RTD_CalculateTemperatureBatch(decimator->sensor_type, temperatures, temperatures, decimator->channel_count);
+
+    for (channel = 0U; channel < decimator->channel_count; channel++)
+    {
+        temperature = temperatures[channel];
+
+        if ( (decimator->curvature_correction != 0U) && (temperature != RTD_CONVERSION_FAILED) )
+        {
+            active_c = (temperature < 0.0) ? RTD_C_COEFFICIENT : 0.0;
+            sensitivity = RTD_CalculateSensitivity(decimator->sensor_type, temperature);
+            curvature = decimator->resistance_at_zero * (2.0 * RTD_B_COEFFICIENT + active_c * temperature * (12.0 * temperature - 600.0));
+            temperatures[channel] = temperature - ((0.5 * curvature * decimator->sum_squares[channel]) / (sensitivity * sensitivity * sensitivity));
+        }
+
+        decimator->sum_squares[channel] = 0.0;
+    }
+
+    decimator->phase = 0U;
+}
+
+/**
+ * @brief Sorts each column of a window matrix in ascending order.
+ *
+ * @details
+ * Odd-even transposition network: @p window passes of compare-exchanges between neighbouring
+ * rows. Every compare-exchange is a unit-stride loop over the channels of the block, so the
+ * network vectorizes across channels.
+ */
+static void RTD_SortWindow(double rows[][RTD_HAMPEL_BLOCK_SIZE], uint32_t window, uint32_t count)
+{
+    uint32_t pass = 0U, row = 0U, index = 0U;
+    double lower = 0.0, upper = 0.0;
+    double *first_row = NULL, *second_row = NULL;
+
+    for (pass = 0U; pass < window; pass++)
+    {
+        for (row = (pass & 1U); (row + 1U) < window; row += 2U)
+        {
+            first_row = rows[row];
+            second_row = rows[row + 1U];
+
+            for (index = 0U; index < count; index++)
+            {
+                lower = first_row[index];
+                upper = second_row[index];
+                first_row[index] = (lower < upper) ? lower : upper;
+                second_row[index] = (lower > upper) ? lower : upper;
+            }
+        }
+    }
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes a decimator with an empty window.
+ *
+ * @param[out] decimator             Decimator to initialize.
+ * @param[in]  sensor_type           The RTD sensor type of all channels.
+ * @param[in]  reference             Storage for @p channel_count window references.
+ * @param[in]  sum                   Storage for @p channel_count sums.
+ * @param[in]  sum_squares           Storage for @p channel_count sums of squares.
+ * @param[in]  channel_count         Number of channels.
+ * @param[in]  factor                Decimation factor (>= 1).
+ * @param[in]  curvature_correction  Nonzero to correct the output to the mean of the converted samples.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Decimator_Init(RTD_Decimator_t *decimator, uint16_t sensor_type, double *reference, double *sum, double *sum_squares,
+                           uint32_t channel_count, uint32_t factor, uint8_t curvature_correction)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+    double resistance_at_zero = RTD_CalculateResistance(sensor_type, 0.0);
+
+    if ( (decimator != NULL) && (reference != NULL) && (sum != NULL) && (sum_squares != NULL) && (factor != 0U) &&
+         (resistance_at_zero != RTD_CONVERSION_FAILED) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            reference[channel] = 0.0;
+            sum[channel] = 0.0;
+            sum_squares[channel] = 0.0;
+        }
+
+        decimator->reference = reference;
+        decimator->sum = sum;
+        decimator->sum_squares = sum_squares;
+        decimator->channel_count = channel_count;
+        decimator->factor = factor;
+        decimator->phase = 0U;
+        decimator->sensor_type = sensor_type;
+        decimator->resistance_at_zero = resistance_at_zero;
+        decimator->curvature_correction = curvature_correction;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Accumulates input frames and converts each completed window once.
+ *
+ * @details
+ * @p frames holds @p frame_count frames of @c channel_count resistances each (frame-major, as
+ * delivered by multiplexed acquisition). The per-frame accumulation runs across channels with
+ * unit stride so that compilers vectorize it. Windows may span several calls.
+ *
+ * @param[in,out] decimator     Decimator.
+ * @param[in]     frames        Input resistances in ohms.
+ * @param[in]     frame_count   Number of input frames.
+ * @param[out]    temperatures  Output frames of @c channel_count temperatures in degrees Celsius;
+ *                              room for (@p frame_count / factor + 1) frames is sufficient.
+ *                              Channels whose mean resistance is out of range receive
+ *                              @c RTD_CONVERSION_FAILED.
+ *
+ * @return Number of output frames written.
+ */
+uint32_t RTD_Decimator_Process(RTD_Decimator_t *decimator, const double *frames, uint32_t frame_count, double *temperatures)
+{
+    uint32_t frame = 0U, channel = 0U, channel_count = 0U, outputs = 0U;
+    double deviation = 0.0;
+    const double *frame_values = NULL;
+    double *reference = NULL, *sum = NULL, *sum_squares = NULL;
+
+    if ( (decimator != NULL) && (frames != NULL) && (temperatures != NULL) )
+    {
+        channel_count = decimator->channel_count;
+        reference = decimator->reference;
+        sum = decimator->sum;
+        sum_squares = decimator->sum_squares;
+
+        for (frame = 0U; frame < frame_count; frame++)
+        {
+            frame_values = &frames[(size_t)frame * channel_count];
+
+            if (decimator->phase == 0U)
+            {
+                for (channel = 0U; channel < channel_count; channel++)
+                {
+                    reference[channel] = frame_values[channel];
+                }
+            }
+
+            for (channel = 0U; channel < channel_count; channel++)
+            {
+                deviation = frame_values[channel] - reference[channel];
+                sum[channel] += deviation;
+                sum_squares[channel] += deviation * deviation;
+            }
+
+            decimator->phase++;
+
+            if (decimator->phase == decimator->factor)
+            {
+                RTD_CompleteWindow(decimator, &temperatures[(size_t)outputs * channel_count]);
+                outputs++;
+            }
+        }
+    }
+
+    return outputs;
+}
+
+
+/**
+ * @brief Initializes a Hampel filter.
+ *
+ * @details
+ * The first processed frame fills the whole window, so no sample can be rejected until the
+ * filter has seen a second frame.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  history        Storage for @p window * @p channel_count samples.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  window         Window length; odd, from 3 to @c RTD_HAMPEL_MAX_WINDOW.
+ * @param[in]  threshold      Rejection threshold in robust standard deviations (e.g. 3.0).
+ * @param[in]  min_deviation  Lower limit of the robust standard deviation in ohms (>= 0), which
+ *                            keeps noise-free signals from rejecting every small step.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Hampel_Init(RTD_Hampel_t *filter, double *history, uint32_t channel_count, uint32_t window,
+                        double threshold, double min_deviation)
+{
+    uint8_t is_valid = 0U;
+
+    if ( (filter != NULL) && (history != NULL) && (window >= 3U) && (window <= RTD_HAMPEL_MAX_WINDOW) && ((window & 1U) != 0U) &&
+         (threshold > 0.0) && (min_deviation >= 0.0) )
+    {
+        filter->history = history;
+        filter->channel_count = channel_count;
+        filter->window = window;
+        filter->position = 0U;
+        filter->primed = 0U;
+        filter->threshold = threshold;
+        filter->min_deviation = min_deviation;
+        filter->rejected = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Screens one frame of raw resistances for spikes.
+ *
+ * @details
+ * Medians are computed with a compare-exchange sorting network that runs across channels with
+ * unit stride, so the filter vectorizes like the other stages.
+ *
+ * @param[in,out] filter       Filter.
+ * @param[in]     resistances  @c channel_count resistances in ohms, one per channel.
+ * @param[out]    cleaned      Optional output receiving each accepted resistance, or the window
+ *                             median for rejected ones. May equal @p resistances. Pass @c NULL
+ *                             if not needed.
+ * @param[out]    accept_mask  Optional bit mask receiving bit i set for every accepted channel
+ *                             ((channel_count + 31) / 32 words), suitable as the mask argument of
+ *                             @c RTD_CalculateTemperatureStrided. Pass @c NULL if not needed.
+ *
+ * @return Number of rejected samples.
+ */
+uint32_t RTD_Hampel_Process(RTD_Hampel_t *filter, const double *resistances, double *cleaned, uint32_t *accept_mask)
+{
+    uint32_t rejected = 0U, row = 0U, first = 0U, count = 0U, index = 0U, channel = 0U, accepted = 0U;
+    uint32_t middle = 0U, channel_count = 0U;
+    double resistance = 0.0, median = 0.0, deviation = 0.0, limit = 0.0;
+    double *row_values = NULL;
+    double window_values[RTD_HAMPEL_MAX_WINDOW][RTD_HAMPEL_BLOCK_SIZE];
+    double medians[RTD_HAMPEL_BLOCK_SIZE];
+
+    if ( (filter != NULL) && (resistances != NULL) )
+    {
+        channel_count = filter->channel_count;
+        middle = filter->window >> 1U;
+
+        /* The first frame fills every row, so the window starts as a constant signal */
+        for (row = 0U; row < filter->window; row++)
+        {
+            if ( (row == filter->position) || (filter->primed == 0U) )
+            {
+                row_values = &filter->history[(size_t)row * channel_count];
+
+                for (channel = 0U; channel < channel_count; channel++)
+                {
+                    row_values[channel] = resistances[channel];
+                }
+            }
+        }
+
+        for (first = 0U; first < channel_count; first += count)
+        {
+            count = channel_count - first;
+            count = (count < RTD_HAMPEL_BLOCK_SIZE) ? count : RTD_HAMPEL_BLOCK_SIZE;
+
+            for (row = 0U; row < filter->window; row++)
+            {
+                for (index = 0U; index < count; index++)
+                {
+                    window_values[row][index] = filter->history[((size_t)row * channel_count) + first + index];
+                }
+            }
+
+            RTD_SortWindow(window_values, filter->window, count);
+
+            for (index = 0U; index < count; index++)
+            {
+                medians[index] = window_values[middle][index];
+            }
+
+            for (row = 0U; row < filter->window; row++)
+            {
+                for (index = 0U; index < count; index++)
+                {
+                    window_values[row][index] = fabs(window_values[row][index] - medians[index]);
+                }
+            }
+
+            RTD_SortWindow(window_values, filter->window, count);
+
+            for (index = 0U; index < count; index++)
+            {
+                channel = first + index;
+                resistance = resistances[channel];
+                median = medians[index];
+                deviation = RTD_MAD_SCALE * window_values[middle][index];
+                limit = filter->threshold * ((deviation > filter->min_deviation) ? deviation : filter->min_deviation);
+                accepted = (fabs(resistance - median) <= limit) ? 1U : 0U;
+
+                rejected += 1U - accepted;
+
+                if (cleaned != NULL)
+                {
+                    cleaned[channel] = (accepted != 0U) ? resistance : median;
+                }
+
+                if (accept_mask != NULL)
+                {
+                    if ((channel & 31U) == 0U)
+                    {
+                        accept_mask[channel >> 5U] = 0U;
+                    }
+
+                    accept_mask[channel >> 5U] |= accepted << (channel & 31U);
+                }
+            }
+        }
+
+        filter->primed = 1U;
+        filter->position = (filter->position + 1U == filter->window) ? 0U : (filter->position + 1U);
+        filter->rejected += rejected;
+    }
+
+    return rejected;
+}
+
+/**
+ * @brief Initializes a current-reversal stage that expects a forward frame next.
+ *
+ * @param[out] reversal       Stage to initialize.
+ * @param[in]  sensor_type    The RTD sensor type of all channels.
+ * @param[in]  forward        Storage for @p channel_count forward readings.
+ * @param[in]  offset         Optional storage for @p channel_count offsets, or @c NULL.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Reversal_Init(RTD_Reversal_t *reversal, uint16_t sensor_type, double *forward, double *offset, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+
+    if ( (reversal != NULL) && (forward != NULL) && (RTD_CalculateResistance(sensor_type, 0.0) != RTD_CONVERSION_FAILED) )
+    {
+        reversal->forward = forward;
+        reversal->offset = offset;
+        reversal->channel_count = channel_count;
+        reversal->sensor_type = sensor_type;
+        reversal->pending = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Pairs forward and reverse frames and converts each pair once.
+ *
+ * @details
+ * @p frames holds @p frame_count frames of @c channel_count readings that alternate between
+ * forward and reverse excitation; a pair may span two calls. Each pair is combined directly
+ * into its output frame, which the batch kernel then converts in place, so the stage needs no
+ * intermediate buffer. A forward frame is copied into @c forward only when its reverse frame
+ * arrives in a later call.
+ *
+ * @param[in,out] reversal      Stage.
+ * @param[in]     frames        Signed readings in ohms (see @c RTD_Reversal_t).
+ * @param[in]     frame_count   Number of input frames.
+ * @param[out]    temperatures  Output frames of @c channel_count temperatures in degrees Celsius;
+ *                              room for (@p frame_count / 2 + 1) frames is sufficient.
+ *                              Channels whose resistance is out of range receive
+ *                              @c RTD_CONVERSION_FAILED. May equal @p frames, so pairs are
+ *                              converted inside the acquisition buffer.
+ *
+ * @return Number of output frames written.
+ */
+uint32_t RTD_Reversal_Process(RTD_Reversal_t *reversal, const double *frames, uint32_t frame_count, double *temperatures)
+{
+    uint32_t frame = 0U, channel = 0U, channel_count = 0U, outputs = 0U;
+    const double *forward = NULL, *reverse = NULL;
+    double *output = NULL, *offset = NULL;
+
+    if ( (reversal != NULL) && (frames != NULL) && (temperatures != NULL) )
+    {
+        channel_count = reversal->channel_count;
+        offset = reversal->offset;
+        forward = reversal->forward;
+
+        for (frame = 0U; frame < frame_count; frame++)
+        {
+            if (reversal->pending == 0U)
+            {
+                /* Forward frame: pair it in place with the next frame of this call */
+                forward = &frames[(size_t)frame * channel_count];
+                reversal->pending = 1U;
+            }
+            else
+            {
+                reverse = &frames[(size_t)frame * channel_count];
+                output = &temperatures[(size_t)outputs * channel_count];
+
+                if (offset != NULL)
+                {
+                    for (channel = 0U; channel < channel_count; channel++)
+                    {
+                        offset[channel] = 0.5 * (forward[channel] + reverse[channel]);
+                    }
+                }
+
+                for (channel = 0U; channel < channel_count; channel++)
+                {
+                    output[channel] = 0.5 * (forward[channel] - reverse[channel]);
+                }
+
+                (void)RTD_CalculateTemperatureBatch(reversal->sensor_type, output, output, channel_count);
+                reversal->pending = 0U;
+                outputs++;
+            }
+        }
+
+        /* Keep an unpaired forward frame for the next call */
+        if ( (reversal->pending != 0U) && (forward != reversal->forward) )
+        {
+            for (channel = 0U; channel < channel_count; channel++)
+            {
+                reversal->forward[channel] = forward[channel];
+            }
+        }
+    }
+
+    return outputs;
+}
+
+
+/* platinum_rtd_prefilter.c */
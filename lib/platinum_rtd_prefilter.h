@@ -0,0 +1,234 @@
+/**
+ * @file    platinum_rtd_prefilter.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Resistance-domain pre-filtering stages for platinum RTD acquisition.
+ *
+ * @details
+ * This file provides a multi-channel decimator that averages raw resistances over a boxcar
+ * window and converts one sample per output, instead of converting every input sample.
+ * Because the Callendar–Van Dusen curve is slightly curved, T(mean R) differs from
+ * mean T(R) by about T''(R) var(R) / 2. An optional second-order correction removes this term,
+ * leaving a third-order residual below 1e-5 K for windows spanning up to 10 K (PT100).
+ *
+ * A streaming Hampel filter rejects single-sample spikes on raw resistance before conversion.
+ * Its accept mask can be passed to @c RTD_CalculateTemperatureStrided, so rejected samples never
+ * reach the solver and never become the seed of a warm-started @c RTD_CalculateTemperature.
+ *
+ * A current-reversal stage pairs readings taken with forward and reverse excitation and cancels
+ * the thermal EMF offset common to both before conversion.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_PREFILTER_H
+#define _PLATINUM_RTD_PREFILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Largest window length supported by @c RTD_Hampel_t */
+#ifndef RTD_HAMPEL_MAX_WINDOW
+#define  RTD_HAMPEL_MAX_WINDOW  9U    /**< Samples per channel window */
+#endif
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Multi-channel boxcar decimator in the resistance domain (structure-of-arrays).
+ *
+ * @details
+ * Resistances are accumulated relative to the first sample of each window, which keeps the
+ * running sums small and the variance free of cancellation. All arrays are provided by the
+ * caller and hold @c channel_count elements.
+ */
+typedef struct
+{
+    double *reference;               /**< First resistance of the current window (ohms)      */
+    double *sum;                     /**< Sum of deviations from @c reference (ohms)          */
+    double *sum_squares;             /**< Sum of squared deviations (ohms^2)                  */
+    uint32_t channel_count;          /**< Number of channels                                  */
+    uint32_t factor;                 /**< Input frames per output frame                       */
+    uint32_t phase;                  /**< Frames accumulated in the current window            */
+    uint16_t sensor_type;            /**< RTD sensor type of all channels                     */
+    double resistance_at_zero;       /**< R0 of @c sensor_type (ohms)                         */
+    uint8_t curvature_correction;    /**< Nonzero to apply the second-order correction        */
+} RTD_Decimator_t;
+
+/**
+ * @brief Streaming multi-channel Hampel filter on raw resistance (structure-of-arrays).
+ *
+ * @details
+ * Each channel keeps its last @c window samples, the current one included. A sample is rejected
+ * when |R - median| > threshold * max(1.4826 * MAD, min_deviation), where MAD is the median
+ * absolute deviation of the window. The history keeps raw samples; the median of an odd window
+ * is not moved by a single spike, and replacing rejected samples would let the window lock onto
+ * a stale level after a genuine step.
+ */
+typedef struct
+{
+    double *history;           /**< window * channel_count samples, one frame per row   */
+    uint32_t channel_count;    /**< Number of channels                                  */
+    uint32_t window;           /**< Window length (odd, 3 to @c RTD_HAMPEL_MAX_WINDOW)   */
+    uint32_t position;         /**< History row written by the next frame               */
+    uint8_t primed;            /**< Nonzero once the history holds a first frame        */
+    double threshold;          /**< Rejection threshold in robust standard deviations   */
+    double min_deviation;      /**< Lower limit of the robust standard deviation (ohms) */
+    uint64_t rejected;         /**< Total number of rejected samples                    */
+} RTD_Hampel_t;
+
+/**
+ * @brief Multi-channel excitation current reversal pairing (structure-of-arrays).
+ *
+ * @details
+ * Readings are signed apparent resistances V / I_nominal. With forward excitation a channel
+ * reads f = R + e and with reverse excitation r = -R + e, where e is the thermal EMF offset
+ * expressed in ohms. Each pair gives R = (f - r) / 2 and e = (f + r) / 2.
+ */
+typedef struct
+{
+    double *forward;            /**< Forward reading kept when a pair spans two calls (ohms)   */
+    double *offset;             /**< Optional offset e of the last pair (ohms), or @c NULL      */
+    uint32_t channel_count;     /**< Number of channels                                        */
+    uint16_t sensor_type;       /**< RTD sensor type of all channels                           */
+    uint8_t pending;            /**< Nonzero while @c forward holds an unpaired forward frame  */
+} RTD_Reversal_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes a decimator with an empty window.
+ *
+ * @param[out] decimator             Decimator to initialize.
+ * @param[in]  sensor_type           The RTD sensor type of all channels.
+ * @param[in]  reference             Storage for @p channel_count window references.
+ * @param[in]  sum                   Storage for @p channel_count sums.
+ * @param[in]  sum_squares           Storage for @p channel_count sums of squares.
+ * @param[in]  channel_count         Number of channels.
+ * @param[in]  factor                Decimation factor (>= 1).
+ * @param[in]  curvature_correction  Nonzero to correct the output to the mean of the converted samples.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Decimator_Init(RTD_Decimator_t *decimator, uint16_t sensor_type, double *reference, double *sum, double *sum_squares,
+                           uint32_t channel_count, uint32_t factor, uint8_t curvature_correction);
+
+/**
+ * @brief Accumulates input frames and converts each completed window once.
+ *
+ * @details
+ * @p frames holds @p frame_count frames of @c channel_count resistances each (frame-major, as
+ * delivered by multiplexed acquisition). The per-frame accumulation runs across channels with
+ * unit stride so that compilers vectorize it. Windows may span several calls.
+ *
+ * @param[in,out] decimator     Decimator.
+ * @param[in]     frames        Input resistances in ohms.
+ * @param[in]     frame_count   Number of input frames.
+ * @param[out]    temperatures  Output frames of @c channel_count temperatures in degrees Celsius;
+ *                              room for (@p frame_count / factor + 1) frames is sufficient.
+ *                              Channels whose mean resistance is out of range receive
+ *                              @c RTD_CONVERSION_FAILED.
+ *
+ * @return Number of output frames written.
+ */
+uint32_t RTD_Decimator_Process(RTD_Decimator_t *decimator, const double *frames, uint32_t frame_count, double *temperatures);
+
+/**
+ * @brief Initializes a Hampel filter.
+ *
+ * @details
+ * The first processed frame fills the whole window, so no sample can be rejected until the
+ * filter has seen a second frame.
+ *
+ * @param[out] filter         Filter to initialize.
+ * @param[in]  history        Storage for @p window * @p channel_count samples.
+ * @param[in]  channel_count  Number of channels.
+ * @param[in]  window         Window length; odd, from 3 to @c RTD_HAMPEL_MAX_WINDOW.
+ * @param[in]  threshold      Rejection threshold in robust standard deviations (e.g. 3.0).
+ * @param[in]  min_deviation  Lower limit of the robust standard deviation in ohms (>= 0), which
+ *                            keeps noise-free signals from rejecting every small step.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Hampel_Init(RTD_Hampel_t *filter, double *history, uint32_t channel_count, uint32_t window,
+                        double threshold, double min_deviation);
+
+/**
+ * @brief Screens one frame of raw resistances for spikes.
+ *
+ * @details
+ * Medians are computed with a compare-exchange sorting network that runs across channels with
+ * unit stride, so the filter vectorizes like the other stages.
+ *
+ * @param[in,out] filter       Filter.
+ * @param[in]     resistances  @c channel_count resistances in ohms, one per channel.
+ * @param[out]    cleaned      Optional output receiving each accepted resistance, or the window
+ *                             median for rejected ones. May equal @p resistances. Pass @c NULL
+ *                             if not needed.
+ * @param[out]    accept_mask  Optional bit mask receiving bit i set for every accepted channel
+ *                             ((channel_count + 31) / 32 words), suitable as the mask argument of
+ *                             @c RTD_CalculateTemperatureStrided. Pass @c NULL if not needed.
+ *
+ * @return Number of rejected samples.
+ */
+uint32_t RTD_Hampel_Process(RTD_Hampel_t *filter, const double *resistances, double *cleaned, uint32_t *accept_mask);
+
+/**
+ * @brief Initializes a current-reversal stage that expects a forward frame next.
+ *
+ * @param[out] reversal       Stage to initialize.
+ * @param[in]  sensor_type    The RTD sensor type of all channels.
+ * @param[in]  forward        Storage for @p channel_count forward readings.
+ * @param[in]  offset         Optional storage for @p channel_count offsets, or @c NULL.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Reversal_Init(RTD_Reversal_t *reversal, uint16_t sensor_type, double *forward, double *offset, uint32_t channel_count);
+
+/**
+ * @brief Pairs forward and reverse frames and converts each pair once.
+ *
+ * @details
+ * @p frames holds @p frame_count frames of @c channel_count readings that alternate between
+ * forward and reverse excitation; a pair may span two calls. Each pair is combined directly
+ * into its output frame, which the batch kernel then converts in place, so the stage needs no
+ * intermediate buffer. A forward frame is copied into @c forward only when its reverse frame
+ * arrives in a later call.
+ *
+ * @param[in,out] reversal      Stage.
+ * @param[in]     frames        Signed readings in ohms (see @c RTD_Reversal_t).
+ * @param[in]     frame_count   Number of input frames.
+ * @param[out]    temperatures  Output frames of @c channel_count temperatures in degrees Celsius;
+ *                              room for (@p frame_count / 2 + 1) frames is sufficient.
+ *                              Channels whose resistance is out of range receive
+ *                              @c RTD_CONVERSION_FAILED. May equal @p frames, so pairs are
+ *                              converted inside the acquisition buffer.
+ *
+ * @return Number of output frames written.
+ */
+uint32_t RTD_Reversal_Process(RTD_Reversal_t *reversal, const double *frames, uint32_t frame_count, double *temperatures);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_prefilter.h */
@@ -25,6 +25,267 @@
 #include "platinum_rtd_sensor.h"    ///< Header file for RTD sensor functions.
 
 
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Elements gathered per block by the descriptor-indexed conversions (stack use ~1 KiB) */
+#define  RTD_GATHER_BLOCK_SIZE  32U
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Looks up the nominal parameters of a sensor type.
+ *
+ * @param[in]  sensor_type         The RTD sensor type.
+ * @param[out] resistance_at_zero  Nominal resistance at 0°C (R0) in ohms.
+ * @param[out] resistance_min      Lowest accepted resistance in ohms.
+ * @param[out] resistance_max      Highest accepted resistance in ohms.
+ *
+ * @return 1 if @p sensor_type is supported, 0 otherwise (outputs are left unchanged).
+ */
+static uint8_t RTD_GetSensorParameters(uint16_t sensor_type, double *resistance_at_zero, double *resistance_min, double *resistance_max)
+{
+    uint8_t is_valid = 1U;
+
+    switch (sensor_type)
+    {
+        case RTD_SENSOR_PT50:
+            *resistance_at_zero = 50.0;
+            *resistance_min = 9.2;
+            *resistance_max = 195.3;
+        break;
+        case RTD_SENSOR_PT100:
+            *resistance_at_zero = 100.0;
+            *resistance_min = 18.3;
+            *resistance_max = 390.6;
+        break;
+        case RTD_SENSOR_PT200:
+            *resistance_at_zero = 200.0;
+            *resistance_min = 36.5;
+            *resistance_max = 781.3;
+        break;
+        case RTD_SENSOR_PT500:
+            *resistance_at_zero = 500.0;
+            *resistance_min = 91.5;
+            *resistance_max = 1953.0;
+        break;
+        case RTD_SENSOR_PT1000:
+            *resistance_at_zero = 1000.0;
+            *resistance_min = 182.5;
+            *resistance_max = 3906.5;
+        break;
+        default:
+            is_valid = 0U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Solves the Callendar–Van Dusen equation for temperature given the ratio W = R / R0.
+ *
+ * @details
+ * Batch kernel shared by all array conversions. The quadratic branch (T >= 0°C) is solved in
+ * closed form with a cancellation-free root formula; below 0°C a fixed number of Newton–Raphson
+ * steps including the C term refine that root. The code is free of data-dependent loops so
+ * compilers can vectorize callers that apply it across arrays, and results do not depend on
+ * neighbouring elements.
+ *
+ * @param[in] resistance_ratio  Measured resistance divided by R0.
+ * @param[in] coefficient_a     Callendar–Van Dusen A coefficient.
+ * @param[in] coefficient_b     Callendar–Van Dusen B coefficient.
+ * @param[in] coefficient_c     Callendar–Van Dusen C coefficient.
+ *
+ * @return Temperature in degrees Celsius (range is not checked).
+ */
+static double RTD_SolveTemperature(double resistance_ratio, double coefficient_a, double coefficient_b, double coefficient_c)
+{
+    const uint8_t newton_iterations = 4U;
+    uint8_t iteration = 0U;
+    double excess = resistance_ratio - 1.0;
+    double temperature = 0.0, estimate = 0.0, active_c = 0.0;
+    double function_value = 0.0, derivative_value = 0.0;
+
+    /* Root of B T^2 + A T - (W - 1) = 0 written as 2 (W - 1) / (A + sqrt(A^2 + 4 B (W - 1))) */
+    temperature = (2.0 * excess) / (coefficient_a + sqrt((coefficient_a * coefficient_a) + (4.0 * coefficient_b * excess)));
+
+    active_c = (temperature < 0.0) ? coefficient_c : 0.0;
+    estimate = temperature;
+
+    for (iteration = 0U; iteration < newton_iterations; iteration++)
+    {
+        function_value = estimate * (coefficient_a + estimate * (coefficient_b + active_c * estimate * (estimate - 100.0))) - excess;
+        derivative_value = coefficient_a + estimate * (2.0 * coefficient_b + active_c * estimate * (4.0 * estimate - 300.0));
+        estimate = estimate - (function_value / derivative_value);
+    }
+
+    return (temperature < 0.0) ? estimate : temperature;
+}
+
+/**
+ * @brief Converts a contiguous block of resistances with fixed sensor parameters.
+ *
+ * @return Number of elements converted successfully.
+ */
+static uint32_t RTD_ConvertBlock(double resistance_at_zero, double resistance_min, double resistance_max,
+                                 const double *resistances, double *temperatures, uint32_t count)
+{
+    uint32_t index = 0U, converted = 0U;
+    double resistance = 0.0, temperature = 0.0;
+    uint8_t in_range = 0U;
+
+    for (index = 0U; index < count; index++)
+    {
+        resistance = resistances[index];
+        in_range = (uint8_t)((resistance >= resistance_min) & (resistance <= resistance_max));
+        temperature = RTD_SolveTemperature(resistance / resistance_at_zero, RTD_A_COEFFICIENT, RTD_B_COEFFICIENT, RTD_C_COEFFICIENT);
+        temperatures[index] = (in_range != 0U) ? temperature : RTD_CONVERSION_FAILED;
+        converted += in_range;
+    }
+
+    return converted;
+}
+
+/**
+ * @brief Error-free sum of two doubles (Knuth two-sum).
+ */
+static RTD_Precise_t RTD_PreciseTwoSum(double a, double b)
+{
+    RTD_Precise_t result;
+    double b_virtual = 0.0;
+
+    result.hi = a + b;
+    b_virtual = result.hi - a;
+    result.lo = (a - (result.hi - b_virtual)) + (b - b_virtual);
+
+    return result;
+}
+
+/**
+ * @brief Renormalizes a double-double so that |lo| <= ulp(hi) / 2.
+ */
+static RTD_Precise_t RTD_PreciseNormalize(double hi, double lo)
+{
+    RTD_Precise_t result;
+
+    result.hi = hi + lo;
+    result.lo = lo - (result.hi - hi);
+
+    return result;
+}
+
+/**
+ * @brief Double-double addition.
+ */
+static RTD_Precise_t RTD_PreciseAdd(RTD_Precise_t x, RTD_Precise_t y)
+{
+    RTD_Precise_t sum = RTD_PreciseTwoSum(x.hi, y.hi);
+    RTD_Precise_t tail = RTD_PreciseTwoSum(x.lo, y.lo);
+
+    sum.lo += tail.hi;
+    sum = RTD_PreciseNormalize(sum.hi, sum.lo);
+    sum.lo += tail.lo;
+
+    return RTD_PreciseNormalize(sum.hi, sum.lo);
+}
+
+/**
+ * @brief Double-double subtraction.
+ */
+static RTD_Precise_t RTD_PreciseSub(RTD_Precise_t x, RTD_Precise_t y)
+{
+    y.hi = -y.hi;
+    y.lo = -y.lo;
+
+    return RTD_PreciseAdd(x, y);
+}
+
+/**
+ * @brief Double-double multiplication (uses @c fma for the exact product).
+ */
+static RTD_Precise_t RTD_PreciseMul(RTD_Precise_t x, RTD_Precise_t y)
+{
+    double product = x.hi * y.hi;
+    double error = fma(x.hi, y.hi, -product);
+
+    error += (x.hi * y.lo) + (x.lo * y.hi);
+
+    return RTD_PreciseNormalize(product, error);
+}
+
+/**
+ * @brief Double-double division.
+ */
+static RTD_Precise_t RTD_PreciseDiv(RTD_Precise_t x, RTD_Precise_t y)
+{
+    RTD_Precise_t quotient;
+    RTD_Precise_t remainder;
+    RTD_Precise_t correction;
+    double first = x.hi / y.hi;
+
+    quotient.hi = first;
+    quotient.lo = 0.0;
+    remainder = RTD_PreciseSub(x, RTD_PreciseMul(quotient, y));
+    correction.hi = remainder.hi / y.hi;
+    correction.lo = 0.0;
+
+    return RTD_PreciseAdd(quotient, correction);
+}
+
+/**
+ * @brief Evaluates the Callendar–Van Dusen ratio W(T) = R(T) / R0 and its derivative in double-double.
+ *
+ * @param[in]  temperature  Temperature in degrees Celsius.
+ * @param[out] derivative   dW/dT at @p temperature (may be @c NULL).
+ *
+ * @return W(T).
+ */
+static RTD_Precise_t RTD_PreciseRatio(RTD_Precise_t temperature, RTD_Precise_t *derivative)
+{
+    const RTD_Precise_t one = { 1.0, 0.0 };
+    const RTD_Precise_t coefficient_a = { RTD_A_COEFFICIENT, RTD_A_COEFFICIENT_LO };
+    const RTD_Precise_t coefficient_b = { RTD_B_COEFFICIENT, RTD_B_COEFFICIENT_LO };
+    const RTD_Precise_t coefficient_c = { RTD_C_COEFFICIENT, RTD_C_COEFFICIENT_LO };
+    RTD_Precise_t scale;
+    RTD_Precise_t ratio;
+    RTD_Precise_t slope;
+
+    if (temperature.hi >= 0.0)
+    {
+        /* W = 1 + T (A + B T),  W' = A + 2 B T */
+        ratio = RTD_PreciseAdd(one, RTD_PreciseMul(temperature, RTD_PreciseAdd(coefficient_a, RTD_PreciseMul(coefficient_b, temperature))));
+        scale.hi = 2.0;
+        scale.lo = 0.0;
+        slope = RTD_PreciseAdd(coefficient_a, RTD_PreciseMul(RTD_PreciseMul(scale, coefficient_b), temperature));
+    }
+    else
+    {
+        /* W = 1 + T (A + T (B + T (-100 C + C T))),  W' = A + T (2 B + T (-300 C + 4 C T)) */
+        scale.hi = -100.0;
+        scale.lo = 0.0;
+        ratio = RTD_PreciseAdd(RTD_PreciseMul(scale, coefficient_c), RTD_PreciseMul(coefficient_c, temperature));
+        ratio = RTD_PreciseAdd(coefficient_b, RTD_PreciseMul(temperature, ratio));
+        ratio = RTD_PreciseAdd(coefficient_a, RTD_PreciseMul(temperature, ratio));
+        ratio = RTD_PreciseAdd(one, RTD_PreciseMul(temperature, ratio));
+
+        scale.hi = 4.0;
+        slope = RTD_PreciseMul(RTD_PreciseMul(scale, coefficient_c), temperature);
+        scale.hi = -300.0;
+        slope = RTD_PreciseAdd(RTD_PreciseMul(scale, coefficient_c), slope);
+        scale.hi = 2.0;
+        slope = RTD_PreciseAdd(RTD_PreciseMul(scale, coefficient_b), RTD_PreciseMul(temperature, slope));
+        slope = RTD_PreciseAdd(coefficient_a, RTD_PreciseMul(temperature, slope));
+    }
+
+    if (derivative != NULL)
+    {
+        *derivative = slope;
+    }
+
+    return ratio;
+}
+
+
 
 /* ------------------------------------- Functions ------------------------------------ */
 
@@ -189,7 +450,7 @@ double RTD_CalculateTemperature(uint16_t sensor_type, double resistance, double
                 temp_squared = temperature_estimate * temperature_estimate;
                 temp_cubed = temp_squared * temperature_estimate;
                 function_value = resistance_at_zero * (1.0 + RTD_A_COEFFICIENT * temperature_estimate + RTD_B_COEFFICIENT * temp_squared + RTD_C_COEFFICIENT * (temperature_estimate - 100.0) * temp_cubed) - resistance;
-                derivative_value = resistance_at_zero * (RTD_A_COEFFICIENT + 2.0 * RTD_B_COEFFICIENT * temperature_estimate + 3.0 * RTD_C_COEFFICIENT * temp_squared - 200.0 * RTD_C_COEFFICIENT * temperature_estimate + 300.0 * RTD_C_COEFFICIENT * temp_squared);
+                derivative_value = resistance_at_zero * (RTD_A_COEFFICIENT + 2.0 * RTD_B_COEFFICIENT * temperature_estimate + 4.0 * RTD_C_COEFFICIENT * temp_cubed - 300.0 * RTD_C_COEFFICIENT * temp_squared);
             }
 
             new_temperature_estimate = temperature_estimate - (function_value / derivative_value);
@@ -208,5 +469,632 @@ double RTD_CalculateTemperature(uint16_t sensor_type, double resistance, double
     return temperature;
 }
 
+/**
+ * @brief Calculates the sensitivity dR/dT of an RTD at a given temperature.
+ *
+ * @details
+ * Evaluates the derivative of the Callendar–Van Dusen equation,
+ * R0 (A + 2 B T) above 0°C and R0 (A + 2 B T + C (4 T^3 - 300 T^2)) below 0°C.
+ * Multiplying a temperature interval by the sensitivity gives the equivalent resistance
+ * interval, which lets deadbands and tolerances be checked without inverse conversions.
+ *
+ * @param[in] sensor_type  The RTD sensor type. Supported values:
+ *                         - @c RTD_SENSOR_PT50  
+ *                         - @c RTD_SENSOR_PT100  
+ *                         - @c RTD_SENSOR_PT200  
+ *                         - @c RTD_SENSOR_PT500  
+ *                         - @c RTD_SENSOR_PT1000
+ * @param[in] temperature  Temperature in degrees Celsius. Must be in range -200°C to +850°C.
+ *
+ * @return Sensitivity in ohms per kelvin.
+ *         Returns @c RTD_CONVERSION_FAILED if the input is invalid.
+ */
+double RTD_CalculateSensitivity(uint16_t sensor_type, double temperature)
+{
+    double sensitivity = RTD_CONVERSION_FAILED;
+    double resistance_at_zero = 0.0, resistance_min = 0.0, resistance_max = 0.0;
+    double active_c = 0.0;
+
+    if ( (temperature >= -200.5) && (temperature <= 850.5) &&
+         (RTD_GetSensorParameters(sensor_type, &resistance_at_zero, &resistance_min, &resistance_max) != 0U) )
+    {
+        active_c = (temperature < 0.0) ? RTD_C_COEFFICIENT : 0.0;
+        sensitivity = resistance_at_zero * (RTD_A_COEFFICIENT + temperature * (2.0 * RTD_B_COEFFICIENT + active_c * temperature * (4.0 * temperature - 300.0)));
+    }
+
+    return sensitivity;
+}
+
+/**
+ * @brief Returns the resistance range accepted by the conversions of a sensor type.
+ *
+ * @details
+ * Resistances inside [@p resistance_min, @p resistance_max] convert successfully with
+ * @c RTD_CalculateTemperatureBatch. Stages that screen raw resistances (voting, diagnostics)
+ * use the range to classify samples without converting them.
+ *
+ * @param[in]  sensor_type     The RTD sensor type (see @c RTD_CalculateSensitivity).
+ * @param[out] resistance_min  Lowest accepted resistance in ohms.
+ * @param[out] resistance_max  Highest accepted resistance in ohms.
+ *
+ * @return 1 if @p sensor_type is supported, 0 otherwise (outputs are left unchanged).
+ */
+uint8_t RTD_GetResistanceRange(uint16_t sensor_type, double *resistance_min, double *resistance_max)
+{
+    uint8_t is_valid = 0U;
+    double resistance_at_zero = 0.0, minimum = 0.0, maximum = 0.0;
+
+    if ( (resistance_min != NULL) && (resistance_max != NULL) &&
+         (RTD_GetSensorParameters(sensor_type, &resistance_at_zero, &minimum, &maximum) != 0U) )
+    {
+        *resistance_min = minimum;
+        *resistance_max = maximum;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Calculates RTD resistance from temperature in double-double precision.
+ *
+ * @details
+ * High-precision counterpart of @c RTD_CalculateResistance. The Callendar–Van Dusen polynomial
+ * is evaluated in double-double arithmetic with the decimal coefficients, so the result is
+ * accurate to about 1e-30 relative. Intended as a reference for accuracy validation and for
+ * metrology use.
+ *
+ * @param[in] sensor_type  The RTD sensor type (see @c RTD_CalculateResistance).
+ * @param[in] temperature  Temperature in degrees Celsius. Must be in range -200°C to +850°C.
+ *
+ * @return Calculated resistance in ohms.
+ *         Returns @c RTD_CONVERSION_FAILED in @c hi (and 0 in @c lo) if the input is invalid.
+ */
+RTD_Precise_t RTD_CalculateResistancePrecise(uint16_t sensor_type, RTD_Precise_t temperature)
+{
+    RTD_Precise_t resistance = { RTD_CONVERSION_FAILED, 0.0 };
+    RTD_Precise_t nominal = { 0.0, 0.0 };
+    double resistance_min = 0.0, resistance_max = 0.0;
+
+    if ( (temperature.hi >= -200.5) && (temperature.hi <= 850.5) &&
+         (RTD_GetSensorParameters(sensor_type, &nominal.hi, &resistance_min, &resistance_max) != 0U) )
+    {
+        resistance = RTD_PreciseMul(nominal, RTD_PreciseRatio(temperature, NULL));
+    }
+
+    return resistance;
+}
+
+/**
+ * @brief Calculates RTD temperature from measured resistance in double-double precision.
+ *
+ * @details
+ * High-precision counterpart of @c RTD_CalculateTemperature. Newton–Raphson iterations are
+ * carried out in double-double arithmetic with the exact derivative of the Callendar–Van Dusen
+ * equation until the correction falls below 1e-26 °C. No initial estimate is required.
+ *
+ * @param[in] sensor_type  The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in] resistance   Measured resistance in ohms.
+ *
+ * @return Calculated temperature in degrees Celsius.
+ *         Returns @c RTD_CONVERSION_FAILED in @c hi (and 0 in @c lo) if the input is invalid
+ *         or the iteration fails to converge.
+ */
+RTD_Precise_t RTD_CalculateTemperaturePrecise(uint16_t sensor_type, RTD_Precise_t resistance)
+{
+    const uint16_t max_iterations = 100U;
+    const double tolerance = 1e-26;
+    uint16_t iteration = 0U;
+    RTD_Precise_t temperature = { RTD_CONVERSION_FAILED, 0.0 };
+    RTD_Precise_t nominal = { 0.0, 0.0 };
+    RTD_Precise_t target_ratio, estimate, ratio, derivative, step;
+    double resistance_min = 0.0, resistance_max = 0.0;
+
+    if ( (RTD_GetSensorParameters(sensor_type, &nominal.hi, &resistance_min, &resistance_max) != 0U) &&
+         (resistance.hi >= resistance_min) && (resistance.hi <= resistance_max) )
+    {
+        target_ratio = RTD_PreciseDiv(resistance, nominal);
+        estimate.hi = (target_ratio.hi - 1.0) / RTD_A_COEFFICIENT;
+        estimate.lo = 0.0;
+
+        while (iteration < max_iterations)
+        {
+            ratio = RTD_PreciseRatio(estimate, &derivative);
+            ratio = RTD_PreciseSub(ratio, target_ratio);
+            step = RTD_PreciseDiv(ratio, derivative);
+            estimate = RTD_PreciseSub(estimate, step);
+
+            if (fabs(step.hi) < tolerance)
+            {
+                temperature = estimate;
+                break;
+            }
+
+            iteration++;
+        }
+    }
+
+    return temperature;
+}
+
+/**
+ * @brief Calculates RTD temperatures for an array of measured resistances.
+ *
+ * @details
+ * Batch counterpart of @c RTD_CalculateTemperature. Each element is solved independently with a
+ * closed-form root of the quadratic branch, refined by a fixed number of Newton–Raphson steps
+ * below 0°C, so no initial estimate is needed and the loop can be vectorized by the compiler.
+ * Results agree with @c RTD_CalculateTemperature within its tolerance and are bit-identical
+ * however the array is split, which makes the function safe to call on disjoint slices from
+ * several threads.
+ *
+ * @param[in]  sensor_type   The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  resistances   Measured resistances in ohms.
+ * @param[out] temperatures  Calculated temperatures in degrees Celsius. Elements that are out of
+ *                           range are set to @c RTD_CONVERSION_FAILED. May alias @p resistances.
+ * @param[in]  count         Number of elements.
+ *
+ * @return Number of elements converted successfully.
+ *
+ * @warning If @p sensor_type is invalid every element is set to @c RTD_CONVERSION_FAILED.
+ */
+uint32_t RTD_CalculateTemperatureBatch(uint16_t sensor_type, const double *resistances, double *temperatures, uint32_t count)
+{
+    uint32_t converted = 0U, index = 0U;
+    double resistance_at_zero = 0.0, resistance_min = 0.0, resistance_max = 0.0;
+
+    if ( (resistances != NULL) && (temperatures != NULL) )
+    {
+        if (RTD_GetSensorParameters(sensor_type, &resistance_at_zero, &resistance_min, &resistance_max) != 0U)
+        {
+            converted = RTD_ConvertBlock(resistance_at_zero, resistance_min, resistance_max, resistances, temperatures, count);
+        }
+        else
+        {
+            for (index = 0U; index < count; index++)
+            {
+                temperatures[index] = RTD_CONVERSION_FAILED;
+            }
+        }
+    }
+
+    return converted;
+}
+
+/**
+ * @brief Returns the number of chunks an array is split into by @c RTD_CalculateTemperatureChunk.
+ *
+ * @param[in] count       Total number of elements.
+ * @param[in] chunk_size  Elements per chunk, or 0 for @c RTD_BATCH_CHUNK_SIZE.
+ *
+ * @return Number of chunks (0 if @p count is 0).
+ */
+uint32_t RTD_GetChunkCount(uint32_t count, uint32_t chunk_size)
+{
+    uint32_t chunk_count = 0U;
+
+    if (chunk_size == 0U)
+    {
+        chunk_size = RTD_BATCH_CHUNK_SIZE;
+    }
+
+    chunk_count = (count / chunk_size) + (((count % chunk_size) != 0U) ? 1U : 0U);
+
+    return chunk_count;
+}
+
+/**
+ * @brief Calculates RTD temperatures for one chunk of a large array.
+ *
+ * @details
+ * Converts elements [chunk_index * chunk_size, min(count, (chunk_index + 1) * chunk_size)) of
+ * the arrays with @c RTD_CalculateTemperatureBatch. The library does not create threads: a
+ * parallel engine hands chunk indices from 0 to @c RTD_GetChunkCount() - 1 to its workers, for
+ * example by letting each worker atomically increment a shared index, so faster workers take
+ * more chunks. Because the batch kernel is element-wise, the combined output is bit-identical
+ * to a single @c RTD_CalculateTemperatureBatch call for any chunk size and thread count.
+ *
+ * @param[in]  sensor_type   The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  resistances   Measured resistances in ohms (whole array).
+ * @param[out] temperatures  Calculated temperatures in degrees Celsius (whole array).
+ * @param[in]  count         Total number of elements in the arrays.
+ * @param[in]  chunk_size    Elements per chunk, or 0 for @c RTD_BATCH_CHUNK_SIZE.
+ * @param[in]  chunk_index   Index of the chunk to convert.
+ *
+ * @return Number of elements of the chunk converted successfully (0 if @p chunk_index is past the end).
+ */
+uint32_t RTD_CalculateTemperatureChunk(uint16_t sensor_type, const double *resistances, double *temperatures,
+                                       uint32_t count, uint32_t chunk_size, uint32_t chunk_index)
+{
+    uint32_t converted = 0U, first = 0U, length = 0U;
+
+    if (chunk_size == 0U)
+    {
+        chunk_size = RTD_BATCH_CHUNK_SIZE;
+    }
+
+    if ( (resistances != NULL) && (temperatures != NULL) && (chunk_index < RTD_GetChunkCount(count, chunk_size)) )
+    {
+        first = chunk_index * chunk_size;
+        length = ((count - first) < chunk_size) ? (count - first) : chunk_size;
+        converted = RTD_CalculateTemperatureBatch(sensor_type, &resistances[first], &temperatures[first], length);
+    }
+
+    return converted;
+}
+
+/**
+ * @brief Initializes an empty sensor descriptor table.
+ *
+ * @param[out] table  Descriptor table to initialize.
+ */
+void RTD_InitDescriptorTable(RTD_DescriptorTable_t *table)
+{
+    uint8_t index = 0U;
+
+    if (table != NULL)
+    {
+        for (index = 0U; index < RTD_MAX_DESCRIPTORS; index++)
+        {
+            table->resistance_at_zero[index] = 1.0;
+            table->coefficient_a[index] = RTD_A_COEFFICIENT;
+            table->coefficient_b[index] = RTD_B_COEFFICIENT;
+            table->coefficient_c[index] = RTD_C_COEFFICIENT;
+            table->resistance_min[index] = 0.0;
+            table->resistance_max[index] = -1.0;
+        }
+
+        table->count = 0U;
+    }
+}
+
+/**
+ * @brief Adds a standard sensor type to a descriptor table.
+ *
+ * @param[in,out] table        Descriptor table.
+ * @param[in]     sensor_type  The RTD sensor type (see @c RTD_CalculateTemperature).
+ *
+ * @return Index of the new descriptor, or @c RTD_INVALID_DESCRIPTOR if the sensor type is
+ *         invalid or the table is full.
+ */
+uint8_t RTD_AddDescriptor(RTD_DescriptorTable_t *table, uint16_t sensor_type)
+{
+    uint8_t index = RTD_INVALID_DESCRIPTOR;
+    double resistance_at_zero = 0.0, resistance_min = 0.0, resistance_max = 0.0;
+
+    if ( (table != NULL) && (table->count < RTD_MAX_DESCRIPTORS) &&
+         (RTD_GetSensorParameters(sensor_type, &resistance_at_zero, &resistance_min, &resistance_max) != 0U) )
+    {
+        index = table->count;
+        table->resistance_at_zero[index] = resistance_at_zero;
+        table->coefficient_a[index] = RTD_A_COEFFICIENT;
+        table->coefficient_b[index] = RTD_B_COEFFICIENT;
+        table->coefficient_c[index] = RTD_C_COEFFICIENT;
+        table->resistance_min[index] = resistance_min;
+        table->resistance_max[index] = resistance_max;
+        table->count++;
+    }
+
+    return index;
+}
+
+/**
+ * @brief Adds a sensor with individually calibrated coefficients to a descriptor table.
+ *
+ * @details
+ * The accepted resistance range is the image of -200.5°C to +850.5°C under the given curve,
+ * as for the standard types. The curve must increase over the whole range, which rejects
+ * coefficients that the batch kernel cannot invert.
+ *
+ * @param[in,out] table               Descriptor table.
+ * @param[in]     resistance_at_zero  Resistance at 0°C (R0) in ohms (> 0).
+ * @param[in]     coefficient_a       Callendar–Van Dusen A coefficient.
+ * @param[in]     coefficient_b       Callendar–Van Dusen B coefficient.
+ * @param[in]     coefficient_c       Callendar–Van Dusen C coefficient (applied below 0°C).
+ *
+ * @return Index of the new descriptor, or @c RTD_INVALID_DESCRIPTOR if the coefficients are
+ *         invalid or the table is full.
+ */
+uint8_t RTD_AddCustomDescriptor(RTD_DescriptorTable_t *table, double resistance_at_zero, double coefficient_a, double coefficient_b,
+                                double coefficient_c)
+{
+    uint8_t index = RTD_INVALID_DESCRIPTOR;
+    const double temperature_min = -200.5, temperature_max = 850.5;
+    double slope_min = 0.0, slope_max = 0.0, cube = 0.0;
+
+    if ( (table != NULL) && (table->count < RTD_MAX_DESCRIPTORS) && (resistance_at_zero > 0.0) )
+    {
+        cube = temperature_min * temperature_min * temperature_min;
+        slope_min = coefficient_a + (2.0 * coefficient_b * temperature_min) + (coefficient_c * ((4.0 * cube) - (300.0 * temperature_min * temperature_min)));
+        slope_max = coefficient_a + (2.0 * coefficient_b * temperature_max);
+
+        /* The slope is linear above 0°C and nearly so below; check it at both ends and at 0°C (A) */
+        if ( (coefficient_a > 0.0) && (slope_min > 0.0) && (slope_max > 0.0) )
+        {
+            index = table->count;
+            table->resistance_at_zero[index] = resistance_at_zero;
+            table->coefficient_a[index] = coefficient_a;
+            table->coefficient_b[index] = coefficient_b;
+            table->coefficient_c[index] = coefficient_c;
+            table->count++;
+            table->resistance_min[index] = RTD_CalculateDescriptorResistance(table, index, temperature_min);
+            table->resistance_max[index] = RTD_CalculateDescriptorResistance(table, index, temperature_max);
+        }
+    }
+
+    return index;
+}
+
+/**
+ * @brief Calculates resistance from temperature with the coefficients of a descriptor.
+ *
+ * @details
+ * Evaluates the same Callendar–Van Dusen form as @c RTD_CalculateResistance with the R0 and
+ * coefficients of descriptor @p descriptor, so custom (calibrated) sensors can be checked
+ * against their measurements.
+ *
+ * @param[in] table        Descriptor table.
+ * @param[in] descriptor   Descriptor index.
+ * @param[in] temperature  Temperature in degrees Celsius. Must be in range -200°C to +850°C.
+ *
+ * @return Calculated resistance in ohms.
+ *         Returns @c RTD_CONVERSION_FAILED if the input is invalid.
+ */
+double RTD_CalculateDescriptorResistance(const RTD_DescriptorTable_t *table, uint8_t descriptor, double temperature)
+{
+    double resistance = RTD_CONVERSION_FAILED;
+    double temp_squared = 0.0, active_c = 0.0;
+
+    if ( (table != NULL) && (descriptor < table->count) && (temperature >= -200.5) && (temperature <= 850.5) )
+    {
+        temp_squared = temperature * temperature;
+        active_c = (temperature < 0.0) ? table->coefficient_c[descriptor] : 0.0;
+        resistance = table->resistance_at_zero[descriptor] *
+                     (1.0 + (table->coefficient_a[descriptor] * temperature) + (table->coefficient_b[descriptor] * temp_squared) +
+                      (active_c * (temperature - 100.0) * temp_squared * temperature));
+    }
+
+    return resistance;
+}
+
+/**
+ * @brief Calculates RTD temperatures for a frame of channels with mixed sensor types.
+ *
+ * @details
+ * Each element selects its descriptor through @p descriptor_indices. R0, coefficients and range
+ * limits are gathered from the table and the shared batch kernel solves the normalized
+ * Callendar–Van Dusen curve, so a mixed frame costs about the same as a homogeneous batch
+ * and produces the same values as @c RTD_CalculateTemperatureBatch for the same sensor type.
+ *
+ * @param[in]  table               Descriptor table.
+ * @param[in]  descriptor_indices  Descriptor index of each element.
+ * @param[in]  resistances         Measured resistances in ohms.
+ * @param[out] temperatures        Calculated temperatures in degrees Celsius. Elements that are
+ *                                 out of range or refer to an unused descriptor are set to
+ *                                 @c RTD_CONVERSION_FAILED. May alias @p resistances.
+ * @param[in]  count               Number of elements.
+ *
+ * @return Number of elements converted successfully.
+ */
+uint32_t RTD_CalculateTemperatureMixed(const RTD_DescriptorTable_t *table, const uint8_t *descriptor_indices,
+                                       const double *resistances, double *temperatures, uint32_t count)
+{
+    const uint32_t block_size = RTD_GATHER_BLOCK_SIZE;
+    uint32_t first = 0U, length = 0U, index = 0U, converted = 0U;
+    uint8_t descriptor = 0U, is_valid = 0U;
+    double resistance = 0.0;
+    double ratios[RTD_GATHER_BLOCK_SIZE];
+    double coefficients_a[RTD_GATHER_BLOCK_SIZE], coefficients_b[RTD_GATHER_BLOCK_SIZE], coefficients_c[RTD_GATHER_BLOCK_SIZE];
+    uint8_t valid[RTD_GATHER_BLOCK_SIZE];
+    const uint8_t *block_indices = NULL;
+    const double *block_resistances = NULL;
+    double *block_temperatures = NULL;
+
+    if ( (table != NULL) && (descriptor_indices != NULL) && (resistances != NULL) && (temperatures != NULL) )
+    {
+        for (first = 0U; first < count; first += length)
+        {
+            length = ((count - first) < block_size) ? (count - first) : block_size;
+            block_indices = &descriptor_indices[first];
+            block_resistances = &resistances[first];
+            block_temperatures = &temperatures[first];
+
+            /* Gather: normalize by R0 and collect the coefficients of each element */
+            for (index = 0U; index < length; index++)
+            {
+                descriptor = block_indices[index];
+                is_valid = (uint8_t)(descriptor < table->count);
+                descriptor = (is_valid != 0U) ? descriptor : 0U;
+                resistance = block_resistances[index];
+                is_valid &= (uint8_t)((resistance >= table->resistance_min[descriptor]) & (resistance <= table->resistance_max[descriptor]));
+                ratios[index] = resistance / table->resistance_at_zero[descriptor];
+                coefficients_a[index] = table->coefficient_a[descriptor];
+                coefficients_b[index] = table->coefficient_b[descriptor];
+                coefficients_c[index] = table->coefficient_c[descriptor];
+                valid[index] = is_valid;
+                converted += is_valid;
+            }
+
+            /* Solve: shared kernel over unit-stride operands */
+            for (index = 0U; index < length; index++)
+            {
+                resistance = RTD_SolveTemperature(ratios[index], coefficients_a[index], coefficients_b[index], coefficients_c[index]);
+                block_temperatures[index] = (valid[index] != 0U) ? resistance : RTD_CONVERSION_FAILED;
+            }
+        }
+    }
+
+    return converted;
+}
+
+/**
+ * @brief Calculates RTD temperatures for strided (interleaved) data with an optional channel mask.
+ *
+ * @details
+ * Reads element i at byte offset i * @p input_stride from @p resistances and writes its
+ * temperature at byte offset i * @p output_stride from @p temperatures. This converts one field
+ * of an array of frame structures, or all channels of one frame, directly inside acquisition
+ * (e.g. DMA) buffers. Selected elements are gathered into a small contiguous block, solved with
+ * the batch kernel and scattered back, so results equal @c RTD_CalculateTemperatureBatch.
+ * Unselected elements are neither read nor solved, and all-zero words of @p mask skip 32
+ * elements at once, so the cost follows the number of selected elements.
+ *
+ * @param[in]  sensor_type    The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  resistances    First measured resistance in ohms.
+ * @param[in]  input_stride   Distance in bytes between consecutive resistances.
+ * @param[out] temperatures   First output temperature in degrees Celsius. Out-of-range elements are
+ *                            set to @c RTD_CONVERSION_FAILED. May point to the same elements as
+ *                            @p resistances (same stride) for in-place conversion.
+ * @param[in]  output_stride  Distance in bytes between consecutive temperatures.
+ * @param[in]  count          Number of elements.
+ * @param[in]  mask           Optional bit mask: element i is converted only if bit (i % 32) of
+ *                            @p mask[i / 32] is set; other outputs are left untouched.
+ *                            Pass @c NULL to convert every element.
+ *
+ * @return Number of selected elements converted successfully.
+ *
+ * @warning Both strides must be multiples of the alignment of @c double.
+ */
+uint32_t RTD_CalculateTemperatureStrided(uint16_t sensor_type, const double *resistances, uint32_t input_stride,
+                                         double *temperatures, uint32_t output_stride, uint32_t count, const uint32_t *mask)
+{
+    const uint32_t block_size = RTD_GATHER_BLOCK_SIZE;
+    uint32_t element = 0U, length = 0U, index = 0U, converted = 0U;
+    double resistance_at_zero = 0.0, resistance_min = 0.0, resistance_max = 0.0;
+    double block_resistances[RTD_GATHER_BLOCK_SIZE];
+    double block_temperatures[RTD_GATHER_BLOCK_SIZE];
+    uint32_t block_elements[RTD_GATHER_BLOCK_SIZE];
+    const uint8_t *input_bytes = (const uint8_t *)resistances;
+    uint8_t *output_bytes = (uint8_t *)temperatures;
+    uint8_t is_valid_type = 0U;
+
+    if ( (resistances != NULL) && (temperatures != NULL) )
+    {
+        is_valid_type = RTD_GetSensorParameters(sensor_type, &resistance_at_zero, &resistance_min, &resistance_max);
+
+        while (element < count)
+        {
+            /* Gather the selected strided inputs into a contiguous block; empty mask words are skipped whole */
+            length = 0U;
+
+            while ( (element < count) && (length < block_size) )
+            {
+                if ( (mask != NULL) && ((element & 31U) == 0U) && (mask[element >> 5U] == 0U) )
+                {
+                    element = ((count - element) > 32U) ? (element + 32U) : count;
+                }
+                else
+                {
+                    if ( (mask == NULL) || ((mask[element >> 5U] & ((uint32_t)1U << (element & 31U))) != 0U) )
+                    {
+                        block_elements[length] = element;
+                        block_resistances[length] = *(const double *)&input_bytes[(size_t)element * input_stride];
+                        length++;
+                    }
+
+                    element++;
+                }
+            }
+
+            if (is_valid_type != 0U)
+            {
+                (void)RTD_ConvertBlock(resistance_at_zero, resistance_min, resistance_max, block_resistances, block_temperatures, length);
+            }
+            else
+            {
+                for (index = 0U; index < length; index++)
+                {
+                    block_temperatures[index] = RTD_CONVERSION_FAILED;
+                }
+            }
+
+            /* Scatter the results back */
+            for (index = 0U; index < length; index++)
+            {
+                *(double *)&output_bytes[(size_t)block_elements[index] * output_stride] = block_temperatures[index];
+                converted += (block_temperatures[index] != RTD_CONVERSION_FAILED) ? 1U : 0U;
+            }
+        }
+    }
+
+    return converted;
+}
+
+/**
+ * @brief Calculates RTD temperatures for a frame of channels with lead-wire compensation.
+ *
+ * @details
+ * Element i belongs to channel i of @p wiring. Its lead resistance, corrected to
+ * @p lead_temperature, is subtracted from the measured resistance block by block: each block of
+ * @c RTD_GATHER_BLOCK_SIZE elements is corrected into a stack buffer and solved by the batch
+ * kernel while it is still in cache, so the data is read from memory once. For 4-wire channels
+ * the results equal @c RTD_CalculateTemperatureBatch.
+ *
+ * @param[in]  sensor_type       The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  wiring            Lead-wire descriptor of the channels.
+ * @param[in]  resistances       Measured resistances in ohms, leads included.
+ * @param[out] temperatures      Calculated temperatures in degrees Celsius. Elements whose
+ *                               corrected resistance is out of range or whose channel has an
+ *                               invalid wiring mode are set to @c RTD_CONVERSION_FAILED. May
+ *                               alias @p resistances.
+ * @param[in]  count             Number of elements.
+ * @param[in]  lead_temperature  Temperature of the lead wires in degrees Celsius.
+ *
+ * @return Number of elements converted successfully.
+ *
+ * @warning If @p sensor_type is invalid every element is set to @c RTD_CONVERSION_FAILED.
+ */
+uint32_t RTD_CalculateTemperatureWired(uint16_t sensor_type, const RTD_Wiring_t *wiring, const double *resistances,
+                                       double *temperatures, uint32_t count, double lead_temperature)
+{
+    const uint32_t block_size = RTD_GATHER_BLOCK_SIZE;
+    uint32_t first = 0U, length = 0U, index = 0U, converted = 0U;
+    double resistance_at_zero = 0.0, resistance_min = 0.0, resistance_max = 0.0, temperature_offset = 0.0, in_series = 0.0;
+    double corrected = 0.0;
+    double block_resistances[RTD_GATHER_BLOCK_SIZE];
+    const double *lead_resistance = NULL, *lead_coefficient = NULL;
+    const uint8_t *mode = NULL;
+    uint8_t is_valid_type = 0U;
+
+    if ( (wiring != NULL) && (wiring->lead_resistance != NULL) && (wiring->lead_coefficient != NULL) && (wiring->mode != NULL) &&
+         (resistances != NULL) && (temperatures != NULL) )
+    {
+        is_valid_type = RTD_GetSensorParameters(sensor_type, &resistance_at_zero, &resistance_min, &resistance_max);
+        temperature_offset = lead_temperature - wiring->reference_temperature;
+
+        for (first = 0U; first < count; first += length)
+        {
+            length = ((count - first) < block_size) ? (count - first) : block_size;
+            lead_resistance = &wiring->lead_resistance[first];
+            lead_coefficient = &wiring->lead_coefficient[first];
+            mode = &wiring->mode[first];
+
+            /* Correct: subtract the lead resistance at the lead temperature (4-wire weight is 0); an
+               invalid mode yields a negative resistance, which is out of range of every sensor */
+            for (index = 0U; index < length; index++)
+            {
+                in_series = ((mode[index] == RTD_WIRING_2_WIRE) || (mode[index] == RTD_WIRING_3_WIRE)) ? 1.0 : 0.0;
+                corrected = resistances[first + index] -
+                            (in_series * lead_resistance[index] * (1.0 + (lead_coefficient[index] * temperature_offset)));
+                block_resistances[index] = ((in_series != 0.0) || (mode[index] == RTD_WIRING_4_WIRE)) ? corrected : RTD_CONVERSION_FAILED;
+            }
+
+            /* Solve: shared batch kernel on the block while it is in cache */
+            if (is_valid_type != 0U)
+            {
+                converted += RTD_ConvertBlock(resistance_at_zero, resistance_min, resistance_max, block_resistances, &temperatures[first], length);
+            }
+            else
+            {
+                for (index = 0U; index < length; index++)
+                {
+                    temperatures[first + index] = RTD_CONVERSION_FAILED;
+                }
+            }
+        }
+    }
+
+    return converted;
+}
 
 /* platinum_rtd_sensor.c */
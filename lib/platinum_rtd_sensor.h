@@ -31,6 +31,7 @@ extern "C" {
 /* ------------------------------------- Includes ------------------------------------- */
 
 #include <math.h>      ///< Standard C math functions
+#include <stddef.h>    ///< NULL and size definitions
 #include <stdint.h>    ///< Fixed-width integer types
 
 
@@ -45,6 +46,17 @@ extern "C" {
 /** @} */
 
 
+/** @name Callendar–Van Dusen Coefficient Residuals
+ *  Trailing parts such that (@c RTD_x_COEFFICIENT + @c RTD_x_COEFFICIENT_LO) equals the decimal
+ *  coefficient to double-double precision. Used only by the high-precision functions.
+ *  @{
+ */
+#define  RTD_A_COEFFICIENT_LO  1.3078985716674652e-19     /**< Residual of @c RTD_A_COEFFICIENT */
+#define  RTD_B_COEFFICIENT_LO  -2.3485987460380997e-23    /**< Residual of @c RTD_B_COEFFICIENT */
+#define  RTD_C_COEFFICIENT_LO  3.68591531010798e-28       /**< Residual of @c RTD_C_COEFFICIENT */
+/** @} */
+
+
 /** @name RTD Sensor Types
  *  @{
  */
@@ -60,6 +72,92 @@ extern "C" {
 #define  RTD_CONVERSION_FAILED  -1.0e6    /**< Conversion failure return value */
 
 
+/** @brief Default number of elements per chunk for @c RTD_CalculateTemperatureChunk */
+#ifndef RTD_BATCH_CHUNK_SIZE
+#define  RTD_BATCH_CHUNK_SIZE  2048U    /**< 16 KiB of input and 16 KiB of output per chunk */
+#endif
+
+
+/** @brief Capacity of an @c RTD_DescriptorTable_t */
+#ifndef RTD_MAX_DESCRIPTORS
+#define  RTD_MAX_DESCRIPTORS  8U    /**< Maximum number of sensor descriptors per table */
+#endif
+
+
+/** @brief Descriptor index returned when a descriptor cannot be added */
+#define  RTD_INVALID_DESCRIPTOR  0xFFU    /**< Invalid descriptor index */
+
+
+/** @brief Wiring modes of an @c RTD_Wiring_t channel */
+#define  RTD_WIRING_2_WIRE  2U    /**< lead_resistance is the loop resistance of both leads  */
+#define  RTD_WIRING_3_WIRE  3U    /**< lead_resistance is the lead imbalance left uncanceled */
+#define  RTD_WIRING_4_WIRE  4U    /**< Leads fully compensated (no correction)               */
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Double-double number used by the high-precision functions.
+ *
+ * @details
+ * Represents the unevaluated sum @c hi + @c lo, with |lo| <= ulp(hi) / 2, giving roughly
+ * 106 bits of significand on any target with IEEE 754 double arithmetic.
+ */
+typedef struct
+{
+    double hi;    /**< Leading component  */
+    double lo;    /**< Trailing component */
+} RTD_Precise_t;
+
+
+/**
+ * @brief Sensor descriptor table in structure-of-arrays layout.
+ *
+ * @details
+ * Each descriptor holds the nominal resistance R0, the Callendar–Van Dusen coefficients applied
+ * to the normalized ratio R / R0, and the accepted resistance range. Mixed-sensor batch
+ * conversions refer to descriptors by index, so channels of different types share one pass.
+ * Initialize with @c RTD_InitDescriptorTable and fill with @c RTD_AddDescriptor.
+ */
+typedef struct
+{
+    double resistance_at_zero[RTD_MAX_DESCRIPTORS];    /**< Nominal resistance at 0°C (R0) in ohms */
+    double coefficient_a[RTD_MAX_DESCRIPTORS];         /**< Callendar–Van Dusen A coefficient      */
+    double coefficient_b[RTD_MAX_DESCRIPTORS];         /**< Callendar–Van Dusen B coefficient      */
+    double coefficient_c[RTD_MAX_DESCRIPTORS];         /**< Callendar–Van Dusen C coefficient      */
+    double resistance_min[RTD_MAX_DESCRIPTORS];        /**< Lowest accepted resistance in ohms     */
+    double resistance_max[RTD_MAX_DESCRIPTORS];        /**< Highest accepted resistance in ohms    */
+    uint8_t count;                                     /**< Number of descriptors in use           */
+} RTD_DescriptorTable_t;
+
+
+/**
+ * @brief Per-channel lead-wire descriptor in structure-of-arrays layout.
+ *
+ * @details
+ * Element i of each array describes channel i. @c lead_resistance is the resistance at
+ * @c reference_temperature that the conversion subtracts from the measurement as it is, so its
+ * meaning depends on the mode:
+ * - @c RTD_WIRING_2_WIRE: the total loop resistance, i.e. both conductors in series.
+ * - @c RTD_WIRING_3_WIRE: the lead imbalance the front end leaves in the measurement, i.e.
+ *   the resistance difference of the two current-carrying conductors (ratiometric bridge), or
+ *   the one conductor that is not cancelled (single-current excitation). For matched leads
+ *   it is 0.
+ * - @c RTD_WIRING_4_WIRE: ignored; the element is not corrected.
+ *
+ * At lead temperature T the value becomes lead_resistance (1 + lead_coefficient (T -
+ * reference_temperature)). Any other mode is invalid and makes the channel fail. The arrays are
+ * provided by the caller.
+ */
+typedef struct
+{
+    const double *lead_resistance;     /**< Uncompensated lead resistance of each channel (ohms)    */
+    const double *lead_coefficient;    /**< Temperature coefficient of each lead (1/K)               */
+    const uint8_t *mode;               /**< Wiring mode of each channel (@c RTD_WIRING_2_WIRE ...)   */
+    double reference_temperature;      /**< Temperature of the lead resistance values (°C)           */
+} RTD_Wiring_t;
+
+
 /* ------------------------------------ Prototype ------------------------------------- */
       
 /**
@@ -108,6 +206,269 @@ double RTD_CalculateResistance(uint16_t sensor_type, double temperature);
  */
 double RTD_CalculateTemperature(uint16_t sensor_type, double resistance, double initial_temperature_estimate);
 
+/**
+ * @brief Calculates the sensitivity dR/dT of an RTD at a given temperature.
+ *
+ * @details
+ * Evaluates the derivative of the Callendar–Van Dusen equation,
+ * R0 (A + 2 B T) above 0°C and R0 (A + 2 B T + C (4 T^3 - 300 T^2)) below 0°C.
+ * Multiplying a temperature interval by the sensitivity gives the equivalent resistance
+ * interval, which lets deadbands and tolerances be checked without inverse conversions.
+ *
+ * @param[in] sensor_type  The RTD sensor type. Supported values:
+ *                         - @c RTD_SENSOR_PT50  
+ *                         - @c RTD_SENSOR_PT100  
+ *                         - @c RTD_SENSOR_PT200  
+ *                         - @c RTD_SENSOR_PT500  
+ *                         - @c RTD_SENSOR_PT1000
+ * @param[in] temperature  Temperature in degrees Celsius. Must be in range -200°C to +850°C.
+ *
+ * @return Sensitivity in ohms per kelvin.
+ *         Returns @c RTD_CONVERSION_FAILED if the input is invalid.
+ */
+double RTD_CalculateSensitivity(uint16_t sensor_type, double temperature);
+
+/**
+ * @brief Returns the resistance range accepted by the conversions of a sensor type.
+ *
+ * @details
+ * Resistances inside [@p resistance_min, @p resistance_max] convert successfully with
+ * @c RTD_CalculateTemperatureBatch. Stages that screen raw resistances (voting, diagnostics)
+ * use the range to classify samples without converting them.
+ *
+ * @param[in]  sensor_type     The RTD sensor type (see @c RTD_CalculateSensitivity).
+ * @param[out] resistance_min  Lowest accepted resistance in ohms.
+ * @param[out] resistance_max  Highest accepted resistance in ohms.
+ *
+ * @return 1 if @p sensor_type is supported, 0 otherwise (outputs are left unchanged).
+ */
+uint8_t RTD_GetResistanceRange(uint16_t sensor_type, double *resistance_min, double *resistance_max);
+
+/**
+ * @brief Calculates RTD resistance from temperature in double-double precision.
+ *
+ * @details
+ * High-precision counterpart of @c RTD_CalculateResistance. The Callendar–Van Dusen polynomial
+ * is evaluated in double-double arithmetic with the decimal coefficients, so the result is
+ * accurate to about 1e-30 relative. Intended as a reference for accuracy validation and for
+ * metrology use.
+ *
+ * @param[in] sensor_type  The RTD sensor type (see @c RTD_CalculateResistance).
+ * @param[in] temperature  Temperature in degrees Celsius. Must be in range -200°C to +850°C.
+ *
+ * @return Calculated resistance in ohms.
+ *         Returns @c RTD_CONVERSION_FAILED in @c hi (and 0 in @c lo) if the input is invalid.
+ */
+RTD_Precise_t RTD_CalculateResistancePrecise(uint16_t sensor_type, RTD_Precise_t temperature);
+
+/**
+ * @brief Calculates RTD temperature from measured resistance in double-double precision.
+ *
+ * @details
+ * High-precision counterpart of @c RTD_CalculateTemperature. Newton–Raphson iterations are
+ * carried out in double-double arithmetic with the exact derivative of the Callendar–Van Dusen
+ * equation until the correction falls below 1e-26 °C. No initial estimate is required.
+ *
+ * @param[in] sensor_type  The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in] resistance   Measured resistance in ohms.
+ *
+ * @return Calculated temperature in degrees Celsius.
+ *         Returns @c RTD_CONVERSION_FAILED in @c hi (and 0 in @c lo) if the input is invalid
+ *         or the iteration fails to converge.
+ */
+RTD_Precise_t RTD_CalculateTemperaturePrecise(uint16_t sensor_type, RTD_Precise_t resistance);
+
+/**
+ * @brief Calculates RTD temperatures for an array of measured resistances.
+ *
+ * @details
+ * Batch counterpart of @c RTD_CalculateTemperature. Each element is solved independently with a
+ * closed-form root of the quadratic branch, refined by a fixed number of Newton–Raphson steps
+ * below 0°C, so no initial estimate is needed and the loop can be vectorized by the compiler.
+ * Results agree with @c RTD_CalculateTemperature within its tolerance and are bit-identical
+ * however the array is split, which makes the function safe to call on disjoint slices from
+ * several threads.
+ *
+ * @param[in]  sensor_type   The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  resistances   Measured resistances in ohms.
+ * @param[out] temperatures  Calculated temperatures in degrees Celsius. Elements that are out of
+ *                           range are set to @c RTD_CONVERSION_FAILED. May alias @p resistances.
+ * @param[in]  count         Number of elements.
+ *
+ * @return Number of elements converted successfully.
+ *
+ * @warning If @p sensor_type is invalid every element is set to @c RTD_CONVERSION_FAILED.
+ */
+uint32_t RTD_CalculateTemperatureBatch(uint16_t sensor_type, const double *resistances, double *temperatures, uint32_t count);
+
+/**
+ * @brief Returns the number of chunks an array is split into by @c RTD_CalculateTemperatureChunk.
+ *
+ * @param[in] count       Total number of elements.
+ * @param[in] chunk_size  Elements per chunk, or 0 for @c RTD_BATCH_CHUNK_SIZE.
+ *
+ * @return Number of chunks (0 if @p count is 0).
+ */
+uint32_t RTD_GetChunkCount(uint32_t count, uint32_t chunk_size);
+
+/**
+ * @brief Calculates RTD temperatures for one chunk of a large array.
+ *
+ * @details
+ * Converts elements [chunk_index * chunk_size, min(count, (chunk_index + 1) * chunk_size)) of
+ * the arrays with @c RTD_CalculateTemperatureBatch. The library does not create threads: a
+ * parallel engine hands chunk indices from 0 to @c RTD_GetChunkCount() - 1 to its workers, for
+ * example by letting each worker atomically increment a shared index, so faster workers take
+ * more chunks. Because the batch kernel is element-wise, the combined output is bit-identical
+ * to a single @c RTD_CalculateTemperatureBatch call for any chunk size and thread count.
+ *
+ * @param[in]  sensor_type   The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  resistances   Measured resistances in ohms (whole array).
+ * @param[out] temperatures  Calculated temperatures in degrees Celsius (whole array).
+ * @param[in]  count         Total number of elements in the arrays.
+ * @param[in]  chunk_size    Elements per chunk, or 0 for @c RTD_BATCH_CHUNK_SIZE.
+ * @param[in]  chunk_index   Index of the chunk to convert.
+ *
+ * @return Number of elements of the chunk converted successfully (0 if @p chunk_index is past the end).
+ */
+uint32_t RTD_CalculateTemperatureChunk(uint16_t sensor_type, const double *resistances, double *temperatures,
+                                       uint32_t count, uint32_t chunk_size, uint32_t chunk_index);
+
+/**
+ * @brief Initializes an empty sensor descriptor table.
+ *
+ * @param[out] table  Descriptor table to initialize.
+ */
+void RTD_InitDescriptorTable(RTD_DescriptorTable_t *table);
+
+/**
+ * @brief Adds a standard sensor type to a descriptor table.
+ *
+ * @param[in,out] table        Descriptor table.
+ * @param[in]     sensor_type  The RTD sensor type (see @c RTD_CalculateTemperature).
+ *
+ * @return Index of the new descriptor, or @c RTD_INVALID_DESCRIPTOR if the sensor type is
+ *         invalid or the table is full.
+ */
+uint8_t RTD_AddDescriptor(RTD_DescriptorTable_t *table, uint16_t sensor_type);
+
+/**
+ * @brief Adds a sensor with individually calibrated coefficients to a descriptor table.
+ *
+ * @details
+ * The accepted resistance range is the image of -200.5°C to +850.5°C under the given curve,
+ * as for the standard types. The curve must increase over the whole range, which rejects
+ * coefficients that the batch kernel cannot invert.
+ *
+ * @param[in,out] table               Descriptor table.
+ * @param[in]     resistance_at_zero  Resistance at 0°C (R0) in ohms (> 0).
+ * @param[in]     coefficient_a       Callendar–Van Dusen A coefficient.
+ * @param[in]     coefficient_b       Callendar–Van Dusen B coefficient.
+ * @param[in]     coefficient_c       Callendar–Van Dusen C coefficient (applied below 0°C).
+ *
+ * @return Index of the new descriptor, or @c RTD_INVALID_DESCRIPTOR if the coefficients are
+ *         invalid or the table is full.
+ */
+uint8_t RTD_AddCustomDescriptor(RTD_DescriptorTable_t *table, double resistance_at_zero, double coefficient_a, double coefficient_b,
+                                double coefficient_c);
+
+/**
+ * @brief Calculates resistance from temperature with the coefficients of a descriptor.
+ *
+ * @details
+ * Evaluates the same Callendar–Van Dusen form as @c RTD_CalculateResistance with the R0 and
+ * coefficients of descriptor @p descriptor, so custom (calibrated) sensors can be checked
+ * against their measurements.
+ *
+ * @param[in] table        Descriptor table.
+ * @param[in] descriptor   Descriptor index.
+ * @param[in] temperature  Temperature in degrees Celsius. Must be in range -200°C to +850°C.
+ *
+ * @return Calculated resistance in ohms.
+ *         Returns @c RTD_CONVERSION_FAILED if the input is invalid.
+ */
+double RTD_CalculateDescriptorResistance(const RTD_DescriptorTable_t *table, uint8_t descriptor, double temperature);
+
+/**
+ * @brief Calculates RTD temperatures for a frame of channels with mixed sensor types.
+ *
+ * @details
+ * Each element selects its descriptor through @p descriptor_indices. R0, coefficients and range
+ * limits are gathered from the table and the shared batch kernel solves the normalized
+ * Callendar–Van Dusen curve, so a mixed frame costs about the same as a homogeneous batch
+ * and produces the same values as @c RTD_CalculateTemperatureBatch for the same sensor type.
+ *
+ * @param[in]  table               Descriptor table.
+ * @param[in]  descriptor_indices  Descriptor index of each element.
+ * @param[in]  resistances         Measured resistances in ohms.
+ * @param[out] temperatures        Calculated temperatures in degrees Celsius. Elements that are
+ *                                 out of range or refer to an unused descriptor are set to
+ *                                 @c RTD_CONVERSION_FAILED. May alias @p resistances.
+ * @param[in]  count               Number of elements.
+ *
+ * @return Number of elements converted successfully.
+ */
+uint32_t RTD_CalculateTemperatureMixed(const RTD_DescriptorTable_t *table, const uint8_t *descriptor_indices,
+                                       const double *resistances, double *temperatures, uint32_t count);
+
+/**
+ * @brief Calculates RTD temperatures for strided (interleaved) data with an optional channel mask.
+ *
+ * @details
+ * Reads element i at byte offset i * @p input_stride from @p resistances and writes its
+ * temperature at byte offset i * @p output_stride from @p temperatures. This converts one field
+ * of an array of frame structures, or all channels of one frame, directly inside acquisition
+ * (e.g. DMA) buffers. Selected elements are gathered into a small contiguous block, solved with
+ * the batch kernel and scattered back, so results equal @c RTD_CalculateTemperatureBatch.
+ * Unselected elements are neither read nor solved, and all-zero words of @p mask skip 32
+ * elements at once, so the cost follows the number of selected elements.
+ *
+ * @param[in]  sensor_type    The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  resistances    First measured resistance in ohms.
+ * @param[in]  input_stride   Distance in bytes between consecutive resistances.
+ * @param[out] temperatures   First output temperature in degrees Celsius. Out-of-range elements are
+ *                            set to @c RTD_CONVERSION_FAILED. May point to the same elements as
+ *                            @p resistances (same stride) for in-place conversion.
+ * @param[in]  output_stride  Distance in bytes between consecutive temperatures.
+ * @param[in]  count          Number of elements.
+ * @param[in]  mask           Optional bit mask: element i is converted only if bit (i % 32) of
+ *                            @p mask[i / 32] is set; other outputs are left untouched.
+ *                            Pass @c NULL to convert every element.
+ *
+ * @return Number of selected elements converted successfully.
+ *
+ * @warning Both strides must be multiples of the alignment of @c double.
+ */
+uint32_t RTD_CalculateTemperatureStrided(uint16_t sensor_type, const double *resistances, uint32_t input_stride,
+                                         double *temperatures, uint32_t output_stride, uint32_t count, const uint32_t *mask);
+
+/**
+ * @brief Calculates RTD temperatures for a frame of channels with lead-wire compensation.
+ *
+ * @details
+ * Element i belongs to channel i of @p wiring. Its lead resistance, corrected to
+ * @p lead_temperature, is subtracted from the measured resistance block by block: each block of
+ * @c RTD_GATHER_BLOCK_SIZE elements is corrected into a stack buffer and solved by the batch
+ * kernel while it is still in cache, so the data is read from memory once. For 4-wire channels
+ * the results equal @c RTD_CalculateTemperatureBatch.
+ *
+ * @param[in]  sensor_type       The RTD sensor type (see @c RTD_CalculateTemperature).
+ * @param[in]  wiring            Lead-wire descriptor of the channels.
+ * @param[in]  resistances       Measured resistances in ohms, leads included.
+ * @param[out] temperatures      Calculated temperatures in degrees Celsius. Elements whose
+ *                               corrected resistance is out of range or whose channel has an
+ *                               invalid wiring mode are set to @c RTD_CONVERSION_FAILED. May
+ *                               alias @p resistances.
+ * @param[in]  count             Number of elements.
+ * @param[in]  lead_temperature  Temperature of the lead wires in degrees Celsius.
+ *
+ * @return Number of elements converted successfully.
+ *
+ * @warning If @p sensor_type is invalid every element is set to @c RTD_CONVERSION_FAILED.
+ */
+uint32_t RTD_CalculateTemperatureWired(uint16_t sensor_type, const RTD_Wiring_t *wiring, const double *resistances,
+                                       double *temperatures, uint32_t count, double lead_temperature);
+
 
 #ifdef __cplusplus
 }
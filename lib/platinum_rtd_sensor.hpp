@@ -0,0 +1,371 @@
+/**
+ * @file    platinum_rtd_sensor.hpp
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   C++ range and parallel-algorithm adapters for the platinum RTD conversion functions.
+ *
+ * @details
+ * Header-only C++ layer over @c platinum_rtd_sensor.h. It provides:
+ * - @c rtd::to_temperature for single values, iterator pairs and containers or ranges, with
+ *   optional execution-policy overloads (C++17). Contiguous inputs of @c double (pointers,
+ *   @c std::vector iterators, and in C++20 every contiguous iterator) are routed to the batch
+ *   kernel in chunks of @c RTD_BATCH_CHUNK_SIZE; other iterators fall back to @c std::transform.
+ *   Inputs of any length are accepted; the 32-bit counts of the C functions are never exceeded.
+ * - @c rtd::views::to_temperature, a lazy range adaptor (C++20).
+ *
+ * All paths use the same kernel as @c RTD_CalculateTemperatureBatch, so results are identical
+ * whichever entry point or policy is used. No intermediate buffers are allocated.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_SENSOR_HPP
+#define _PLATINUM_RTD_SENSOR_HPP
+
+#if __cplusplus < 201703L
+#error "platinum_rtd_sensor.hpp requires C++17"
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <algorithm>      ///< std::transform, std::for_each
+#include <cstddef>        ///< std::ptrdiff_t
+#include <cstdint>        ///< Fixed-width integer types
+#include <iterator>       ///< Iterator traits, std::data, std::size
+#include <limits>         ///< std::numeric_limits
+#include <memory>         ///< std::addressof, std::to_address
+#include <type_traits>    ///< Type traits
+#include <vector>         ///< std::vector iterators (contiguous before C++20)
+
+#if defined(__has_include)
+#if __has_include(<execution>)
+#include <execution>      ///< Execution policies
+#define RTD_HAS_EXECUTION_POLICIES  1
+#endif
+#endif
+
+#if (__cplusplus >= 202002L) && defined(__has_include)
+#if __has_include(<ranges>)
+#include <ranges>         ///< Range views and concepts
+#define RTD_HAS_RANGES  1
+#endif
+#endif
+
+#include "platinum_rtd_sensor.h"    ///< C conversion functions
+
+
+namespace rtd
+{
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/** @brief RTD sensor types (values match the @c RTD_SENSOR_x macros). */
+enum class sensor : std::uint16_t
+{
+    pt50   = RTD_SENSOR_PT50,      /**< PT50 RTD sensor   */
+    pt100  = RTD_SENSOR_PT100,     /**< PT100 RTD sensor  */
+    pt200  = RTD_SENSOR_PT200,     /**< PT200 RTD sensor  */
+    pt500  = RTD_SENSOR_PT500,     /**< PT500 RTD sensor  */
+    pt1000 = RTD_SENSOR_PT1000     /**< PT1000 RTD sensor */
+};
+
+
+/* ------------------------------------- Details -------------------------------------- */
+
+namespace detail
+{
+
+/** @brief True if @p Iterator is known to address contiguous storage. */
+template <class Iterator>
+struct is_contiguous_iterator
+{
+#if (__cplusplus >= 202002L) && defined(__cpp_lib_concepts)
+    static constexpr bool value = std::contiguous_iterator<Iterator>;
+#else
+    static constexpr bool value = std::is_pointer<Iterator>::value ||
+                                  std::is_same<Iterator, std::vector<double>::iterator>::value ||
+                                  std::is_same<Iterator, std::vector<double>::const_iterator>::value;
+#endif
+};
+
+/** @brief True if @p Iterator addresses contiguous @c double storage of the given constness. */
+template <class Iterator, class Value>
+struct is_contiguous_of
+{
+    using reference_type = typename std::iterator_traits<Iterator>::reference;
+    using value_type = typename std::remove_reference<reference_type>::type;
+
+    static constexpr bool value = is_contiguous_iterator<Iterator>::value && std::is_same<value_type, Value>::value;
+};
+
+/** @brief Raw pointer of a contiguous iterator (must be dereferenceable unless it is a pointer). */
+template <class Iterator>
+inline auto address_of(Iterator iterator) noexcept
+{
+#if (__cplusplus >= 202002L) && defined(__cpp_lib_to_address)
+    return std::to_address(iterator);
+#else
+    if constexpr (std::is_pointer<Iterator>::value)
+    {
+        return iterator;
+    }
+    else
+    {
+        return std::addressof(*iterator);
+    }
+#endif
+}
+
+/** @brief Largest element count passed to one call of the C functions. */
+constexpr std::size_t max_call_count = std::numeric_limits<std::uint32_t>::max() - (std::numeric_limits<std::uint32_t>::max() % RTD_BATCH_CHUNK_SIZE);
+
+/** @brief Converts contiguous storage of any length with the batch kernel. */
+inline void convert_contiguous(sensor sensor_type, const double *resistances, double *temperatures, std::size_t count) noexcept
+{
+    std::size_t length = 0U;
+
+    for (std::size_t first = 0U; first < count; first += length)
+    {
+        length = std::min(count - first, max_call_count);
+        (void)RTD_CalculateTemperatureBatch(static_cast<std::uint16_t>(sensor_type), &resistances[first], &temperatures[first],
+                                            static_cast<std::uint32_t>(length));
+    }
+}
+
+/** @brief Minimal random-access iterator over chunk indices, used to parallelize chunked conversion. */
+class chunk_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::size_t *;
+    using reference = std::size_t;
+
+    chunk_iterator() noexcept = default;
+    explicit chunk_iterator(std::size_t index) noexcept : index_(index) {}
+
+    reference operator*() const noexcept { return index_; }
+    reference operator[](difference_type offset) const noexcept { return static_cast<std::size_t>(index_ + offset); }
+
+    chunk_iterator &operator++() noexcept { ++index_; return *this; }
+    chunk_iterator operator++(int) noexcept { chunk_iterator previous = *this; ++index_; return previous; }
+    chunk_iterator &operator--() noexcept { --index_; return *this; }
+    chunk_iterator operator--(int) noexcept { chunk_iterator previous = *this; --index_; return previous; }
+    chunk_iterator &operator+=(difference_type offset) noexcept { index_ = static_cast<std::size_t>(index_ + offset); return *this; }
+    chunk_iterator &operator-=(difference_type offset) noexcept { index_ = static_cast<std::size_t>(index_ - offset); return *this; }
+
+    friend chunk_iterator operator+(chunk_iterator iterator, difference_type offset) noexcept { return iterator += offset; }
+    friend chunk_iterator operator+(difference_type offset, chunk_iterator iterator) noexcept { return iterator += offset; }
+    friend chunk_iterator operator-(chunk_iterator iterator, difference_type offset) noexcept { return iterator -= offset; }
+    friend difference_type operator-(chunk_iterator lhs, chunk_iterator rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+
+    friend bool operator==(chunk_iterator lhs, chunk_iterator rhs) noexcept { return lhs.index_ == rhs.index_; }
+    friend bool operator!=(chunk_iterator lhs, chunk_iterator rhs) noexcept { return lhs.index_ != rhs.index_; }
+    friend bool operator<(chunk_iterator lhs, chunk_iterator rhs) noexcept { return lhs.index_ < rhs.index_; }
+    friend bool operator>(chunk_iterator lhs, chunk_iterator rhs) noexcept { return lhs.index_ > rhs.index_; }
+    friend bool operator<=(chunk_iterator lhs, chunk_iterator rhs) noexcept { return lhs.index_ <= rhs.index_; }
+    friend bool operator>=(chunk_iterator lhs, chunk_iterator rhs) noexcept { return lhs.index_ >= rhs.index_; }
+
+private:
+    std::size_t index_ = 0U;
+};
+
+}  /* namespace detail */
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Calculates RTD temperature from a single measured resistance.
+ *
+ * @details
+ * Uses the batch kernel, so the result is identical to the corresponding element of
+ * @c RTD_CalculateTemperatureBatch. No initial estimate is required.
+ *
+ * @return Temperature in degrees Celsius, or @c RTD_CONVERSION_FAILED if the input is invalid.
+ */
+inline double to_temperature(sensor sensor_type, double resistance) noexcept
+{
+    double temperature = RTD_CONVERSION_FAILED;
+
+    (void)RTD_CalculateTemperatureBatch(static_cast<std::uint16_t>(sensor_type), &resistance, &temperature, 1U);
+
+    return temperature;
+}
+
+/**
+ * @brief Converts [first, last) into the range beginning at @p d_first.
+ *
+ * @details
+ * Contiguous @c double inputs and outputs are converted in place by the batch kernel, in as
+ * few calls as the 32-bit count of @c RTD_CalculateTemperatureBatch allows; other iterators
+ * are converted element-wise with the same kernel.
+ *
+ * @return Iterator past the last element written.
+ */
+template <class InputIterator, class OutputIterator>
+OutputIterator to_temperature(InputIterator first, InputIterator last, OutputIterator d_first, sensor sensor_type)
+{
+    if constexpr (detail::is_contiguous_of<InputIterator, const double>::value || detail::is_contiguous_of<InputIterator, double>::value)
+    {
+        if constexpr (detail::is_contiguous_of<OutputIterator, double>::value)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+            if (count != 0U)
+            {
+                detail::convert_contiguous(sensor_type, detail::address_of(first), detail::address_of(d_first), count);
+            }
+
+            return d_first + static_cast<std::ptrdiff_t>(count);
+        }
+    }
+
+    return std::transform(first, last, d_first, [sensor_type](double resistance) noexcept { return to_temperature(sensor_type, resistance); });
+}
+
+#if defined(RTD_HAS_EXECUTION_POLICIES)
+
+/**
+ * @brief Converts [first, last) into the range beginning at @p d_first under an execution policy.
+ *
+ * @details
+ * Contiguous @c double inputs and outputs are split into chunks of @c RTD_BATCH_CHUNK_SIZE that
+ * are distributed by @p policy and converted with the batch kernel; results are bit-identical
+ * to the sequential overload. Other iterators use @c std::transform with @p policy.
+ *
+ * @return Iterator past the last element written.
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+OutputIterator to_temperature(ExecutionPolicy &&policy, InputIterator first, InputIterator last, OutputIterator d_first, sensor sensor_type)
+{
+    if constexpr (detail::is_contiguous_of<InputIterator, const double>::value || detail::is_contiguous_of<InputIterator, double>::value)
+    {
+        if constexpr (detail::is_contiguous_of<OutputIterator, double>::value)
+        {
+            const auto count = static_cast<std::size_t>(std::distance(first, last));
+            const std::size_t chunk_count = (count + (RTD_BATCH_CHUNK_SIZE - 1U)) / RTD_BATCH_CHUNK_SIZE;
+
+            if (count != 0U)
+            {
+                const double *resistances = detail::address_of(first);
+                double *temperatures = detail::address_of(d_first);
+
+                std::for_each(std::forward<ExecutionPolicy>(policy), detail::chunk_iterator(0U), detail::chunk_iterator(chunk_count),
+                              [=](std::size_t chunk_index) noexcept
+                              {
+                                  const std::size_t offset = chunk_index * RTD_BATCH_CHUNK_SIZE;
+
+                                  detail::convert_contiguous(sensor_type, &resistances[offset], &temperatures[offset],
+                                                             std::min(count - offset, static_cast<std::size_t>(RTD_BATCH_CHUNK_SIZE)));
+                              });
+            }
+
+            return d_first + static_cast<std::ptrdiff_t>(count);
+        }
+    }
+
+    return std::transform(std::forward<ExecutionPolicy>(policy), first, last, d_first,
+                          [sensor_type](double resistance) noexcept { return to_temperature(sensor_type, resistance); });
+}
+
+#endif  /* RTD_HAS_EXECUTION_POLICIES */
+
+#if !defined(RTD_HAS_RANGES)
+
+/**
+ * @brief Converts a container with @c std::data and @c std::size into another (C++17).
+ *
+ * @return Iterator past the last element written.
+ */
+template <class InputContainer, class OutputContainer,
+          class = decltype(std::data(std::declval<const InputContainer &>()) + std::size(std::declval<const InputContainer &>())),
+          class = decltype(std::data(std::declval<OutputContainer &>()))>
+auto to_temperature(const InputContainer &resistances, OutputContainer &&temperatures, sensor sensor_type)
+{
+    (void)to_temperature(std::data(resistances), std::data(resistances) + std::size(resistances), std::data(temperatures), sensor_type);
+
+    return std::next(std::begin(temperatures), static_cast<std::ptrdiff_t>(std::size(resistances)));
+}
+
+#if defined(RTD_HAS_EXECUTION_POLICIES)
+
+/**
+ * @brief Converts a container with @c std::data and @c std::size into another under an execution policy (C++17).
+ *
+ * @return Iterator past the last element written.
+ */
+template <class ExecutionPolicy, class InputContainer, class OutputContainer,
+          class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type,
+          class = decltype(std::data(std::declval<const InputContainer &>()) + std::size(std::declval<const InputContainer &>())),
+          class = decltype(std::data(std::declval<OutputContainer &>()))>
+auto to_temperature(ExecutionPolicy &&policy, const InputContainer &resistances, OutputContainer &&temperatures, sensor sensor_type)
+{
+    (void)to_temperature(std::forward<ExecutionPolicy>(policy), std::data(resistances), std::data(resistances) + std::size(resistances),
+                         std::data(temperatures), sensor_type);
+
+    return std::next(std::begin(temperatures), static_cast<std::ptrdiff_t>(std::size(resistances)));
+}
+
+#endif  /* RTD_HAS_EXECUTION_POLICIES */
+
+#else
+
+/**
+ * @brief Converts an input range into an output range (C++20).
+ *
+ * @return Iterator past the last element written.
+ */
+template <std::ranges::input_range InputRange, std::ranges::range OutputRange>
+auto to_temperature(const InputRange &resistances, OutputRange &&temperatures, sensor sensor_type)
+{
+    return to_temperature(std::ranges::begin(resistances), std::ranges::end(resistances), std::ranges::begin(temperatures), sensor_type);
+}
+
+/**
+ * @brief Converts an input range into an output range under an execution policy (C++20).
+ *
+ * @return Iterator past the last element written.
+ */
+template <class ExecutionPolicy, std::ranges::input_range InputRange, std::ranges::range OutputRange>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+auto to_temperature(ExecutionPolicy &&policy, const InputRange &resistances, OutputRange &&temperatures, sensor sensor_type)
+{
+    return to_temperature(std::forward<ExecutionPolicy>(policy), std::ranges::begin(resistances), std::ranges::end(resistances),
+                          std::ranges::begin(temperatures), sensor_type);
+}
+
+namespace views
+{
+
+/**
+ * @brief Lazy range adaptor converting resistances to temperatures on access (C++20).
+ *
+ * @details
+ * Usage: <tt>for (double t : readings | rtd::views::to_temperature(rtd::sensor::pt100)) { ... }</tt>.
+ * Nothing is converted until an element is read, and no storage is allocated.
+ */
+inline auto to_temperature(sensor sensor_type)
+{
+    return std::views::transform([sensor_type](double resistance) noexcept { return rtd::to_temperature(sensor_type, resistance); });
+}
+
+}  /* namespace views */
+
+#endif  /* RTD_HAS_RANGES */
+
+}  /* namespace rtd */
+
+
+#endif  /* platinum_rtd_sensor.hpp */
@@ -0,0 +1,654 @@
+/**
+ * @file    platinum_rtd_stats.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Temperature statistics for platinum RTD data computed in the resistance domain.
+ *
+ * @details
+ * This file implements the resistance-domain histograms, the code-histogram statistics and the
+ * rollup stage declared in @c platinum_rtd_stats.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_stats.h"    ///< Header file for RTD statistics functions.
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Channels updated per block by @c RTD_Rollup_AddFrame (input block stays in L1) */
+#define  RTD_ROLLUP_BLOCK_SIZE  256U
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Adds temperatures of consecutive channels to the shortest window.
+ *
+ * @details
+ * Validity is carried as a 0/1 weight: an invalid sample adds nothing to the moments and is
+ * replaced by +/-@c HUGE_VAL for min and max. The moments and the extremes are updated in two
+ * loops, so each loop has few enough arrays to vectorize without exceeding the alias checks.
+ */
+static void RTD_RollupAddBlock(RTD_Rollup_t *rollup, const double *temperatures, uint32_t first_channel, uint32_t length)
+{
+    uint32_t index = 0U;
+    double temperature = 0.0, valid = 0.0, count = 0.0, delta = 0.0, mean = 0.0, low = 0.0, high = 0.0;
+    double *counts = &rollup->count[first_channel];
+    double *means = &rollup->mean[first_channel];
+    double *m2s = &rollup->m2[first_channel];
+    double *failed = &rollup->failed[first_channel];
+    double *mins = &rollup->min[first_channel];
+    double *maxs = &rollup->max[first_channel];
+
+    for (index = 0U; index < length; index++)
+    {
+        temperature = temperatures[index];
+        valid = (temperature != RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+        count = counts[index] + valid;
+        delta = valid * (temperature - means[index]);
+
+        /* (count + 1 - valid) equals count for a valid sample and is never 0 otherwise */
+        mean = means[index] + (delta / (count + 1.0 - valid));
+        m2s[index] += delta * (temperature - mean);
+        means[index] = mean;
+        counts[index] = count;
+    }
+
+    for (index = 0U; index < length; index++)
+    {
+        temperature = temperatures[index];
+        valid = (temperature != RTD_CONVERSION_FAILED) ? 1.0 : 0.0;
+        failed[index] += 1.0 - valid;
+        low = (valid > 0.0) ? temperature : HUGE_VAL;
+        high = (valid > 0.0) ? temperature : -HUGE_VAL;
+        low = (low < mins[index]) ? low : mins[index];
+        high = (high > maxs[index]) ? high : maxs[index];
+        mins[index] = low;
+        maxs[index] = high;
+    }
+}
+
+/**
+ * @brief Closes the open window of one level.
+ *
+ * @details
+ * Every channel with samples in the window emits a record and is merged into the next level with
+ * the pairwise update of Chan et al.:
+ *
+ *     mean = mean_a + d n_b / n,   m2 = m2_a + m2_b + d^2 n_a n_b / n,   d = mean_b - mean_a
+ *
+ * @return Number of records appended.
+ */
+static uint32_t RTD_RollupClose(RTD_Rollup_t *rollup, uint32_t level)
+{
+    uint32_t channel = 0U, appended = 0U;
+    size_t source = 0U, target = 0U;
+    double count = 0.0, total = 0.0, delta = 0.0;
+    RTD_RollupRecord_t *record = NULL;
+
+    for (channel = 0U; channel < rollup->channel_count; channel++)
+    {
+        source = ((size_t)level * rollup->channel_count) + channel;
+        count = rollup->count[source];
+
+        if ( (count + rollup->failed[source]) > 0.0 )
+        {
+            if (rollup->record_count < rollup->record_capacity)
+            {
+                record = &rollup->records[rollup->record_count];
+                record->start = rollup->start[level];
+                record->channel = channel;
+                record->level = level;
+                record->stats.sample_count = (uint64_t)count;
+                record->stats.failed_count = (uint64_t)rollup->failed[source];
+
+                if (count > 0.0)
+                {
+                    record->stats.mean = rollup->mean[source];
+                    record->stats.std_deviation = sqrt(rollup->m2[source] / count);
+                    record->stats.min = rollup->min[source];
+                    record->stats.max = rollup->max[source];
+                }
+                else
+                {
+                    record->stats.mean = RTD_CONVERSION_FAILED;
+                    record->stats.std_deviation = RTD_CONVERSION_FAILED;
+                    record->stats.min = RTD_CONVERSION_FAILED;
+                    record->stats.max = RTD_CONVERSION_FAILED;
+                }
+
+                rollup->record_count++;
+                appended++;
+            }
+            else
+            {
+                rollup->dropped++;
+            }
+
+            if ((level + 1U) < rollup->level_count)
+            {
+                target = source + rollup->channel_count;
+                total = rollup->count[target] + count;
+
+                if (count > 0.0)
+                {
+                    delta = rollup->mean[source] - rollup->mean[target];
+                    rollup->m2[target] += rollup->m2[source] + ((delta * delta) * ((rollup->count[target] * count) / total));
+                    rollup->mean[target] += delta * (count / total);
+                    rollup->min[target] = (rollup->min[source] < rollup->min[target]) ? rollup->min[source] : rollup->min[target];
+                    rollup->max[target] = (rollup->max[source] > rollup->max[target]) ? rollup->max[source] : rollup->max[target];
+                }
+
+                rollup->count[target] = total;
+                rollup->failed[target] += rollup->failed[source];
+            }
+        }
+
+        rollup->count[source] = 0.0;
+        rollup->failed[source] = 0.0;
+        rollup->mean[source] = 0.0;
+        rollup->m2[source] = 0.0;
+        rollup->min[source] = HUGE_VAL;
+        rollup->max[source] = -HUGE_VAL;
+    }
+
+    return appended;
+}
+
+/**
+ * @brief Closes every window that ended before a timestamp and aligns the open windows to it.
+ *
+ * @return Number of records appended.
+ */
+static uint32_t RTD_RollupAdvance(RTD_Rollup_t *rollup, uint64_t timestamp)
+{
+    uint32_t level = 0U, appended = 0U;
+
+    if (rollup->started == 0U)
+    {
+        for (level = 0U; level < rollup->level_count; level++)
+        {
+            rollup->start[level] = timestamp - (timestamp % rollup->period[level]);
+        }
+
+        rollup->started = 1U;
+    }
+    else
+    {
+        /* Periods are nested, so a level whose window is still open ends the cascade */
+        for (level = 0U; (level < rollup->level_count) && (timestamp >= (rollup->start[level] + rollup->period[level])); level++)
+        {
+            appended += RTD_RollupClose(rollup, level);
+            rollup->start[level] = timestamp - (timestamp % rollup->period[level]);
+        }
+    }
+
+    return appended;
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes an empty histogram from temperature bin edges.
+ *
+ * @param[out] histogram          Histogram to initialize.
+ * @param[in]  sensor_type        The RTD sensor type of the binned data.
+ * @param[in]  temperature_edges  @p bin_count + 1 strictly ascending edges in degrees Celsius,
+ *                                within -200°C to +850°C.
+ * @param[in]  bin_count          Number of bins (>= 1).
+ * @param[in]  resistance_edges   Storage for @p bin_count + 1 resistance edges.
+ * @param[in]  counts             Storage for @p bin_count counters.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Histogram_Init(RTD_Histogram_t *histogram, uint16_t sensor_type, const double *temperature_edges, uint32_t bin_count,
+                           double *resistance_edges, uint64_t *counts)
+{
+    uint8_t is_valid = 0U;
+    uint32_t edge = 0U;
+
+    if ( (histogram != NULL) && (temperature_edges != NULL) && (resistance_edges != NULL) && (counts != NULL) && (bin_count != 0U) )
+    {
+        is_valid = 1U;
+
+        for (edge = 0U; (edge <= bin_count) && (is_valid != 0U); edge++)
+        {
+            resistance_edges[edge] = RTD_CalculateResistance(sensor_type, temperature_edges[edge]);
+
+            if ( (resistance_edges[edge] == RTD_CONVERSION_FAILED) ||
+                 ((edge != 0U) && (resistance_edges[edge] <= resistance_edges[edge - 1U])) )
+            {
+                is_valid = 0U;
+            }
+        }
+
+        if (is_valid != 0U)
+        {
+            histogram->resistance_edges = resistance_edges;
+            histogram->counts = counts;
+            histogram->bin_count = bin_count;
+            RTD_Histogram_Reset(histogram);
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Clears all counters of a histogram.
+ *
+ * @param[in,out] histogram  Histogram.
+ */
+void RTD_Histogram_Reset(RTD_Histogram_t *histogram)
+{
+    uint32_t bin = 0U;
+
+    if (histogram != NULL)
+    {
+        for (bin = 0U; bin < histogram->bin_count; bin++)
+        {
+            histogram->counts[bin] = 0U;
+        }
+
+        histogram->underflow = 0U;
+        histogram->overflow = 0U;
+    }
+}
+
+/**
+ * @brief Adds raw resistance samples to a histogram.
+ *
+ * @details
+ * Each sample is located with a branch-free binary search over the resistance edges
+ * (ceil(log2(bin_count + 1)) steps); no temperature conversion is performed.
+ *
+ * @param[in,out] histogram    Histogram.
+ * @param[in]     resistances  Measured resistances in ohms.
+ * @param[in]     count        Number of samples.
+ */
+void RTD_Histogram_Add(RTD_Histogram_t *histogram, const double *resistances, uint32_t count)
+{
+    uint32_t index = 0U, base = 0U, length = 0U, half = 0U;
+    double resistance = 0.0, lowest = 0.0, highest = 0.0;
+    const double *edges = NULL;
+
+    if ( (histogram != NULL) && (resistances != NULL) )
+    {
+        edges = histogram->resistance_edges;
+        lowest = edges[0];
+        highest = edges[histogram->bin_count];
+
+        for (index = 0U; index < count; index++)
+        {
+            resistance = resistances[index];
+
+            if (!(resistance >= lowest))
+            {
+                histogram->underflow++;
+            }
+            else if (resistance >= highest)
+            {
+                histogram->overflow++;
+            }
+            else
+            {
+                /* Largest edge index with edges[base] <= resistance; compiles to conditional moves */
+                base = 0U;
+                length = histogram->bin_count + 1U;
+
+                while (length > 1U)
+                {
+                    half = length >> 1U;
+                    base = (edges[base + half] <= resistance) ? (base + half) : base;
+                    length -= half;
+                }
+
+                histogram->counts[base]++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Adds the counts of one histogram to another.
+ *
+ * @details
+ * Used to combine per-thread histograms. Both histograms must have identical edges.
+ *
+ * @param[in,out] destination  Histogram receiving the counts.
+ * @param[in]     source       Histogram to add.
+ *
+ * @return 1 on success, 0 if the histograms are incompatible.
+ */
+uint8_t RTD_Histogram_Merge(RTD_Histogram_t *destination, const RTD_Histogram_t *source)
+{
+    uint8_t is_valid = 0U;
+    uint32_t bin = 0U;
+
+    if ( (destination != NULL) && (source != NULL) && (destination->bin_count == source->bin_count) )
+    {
+        is_valid = 1U;
+
+        for (bin = 0U; bin <= destination->bin_count; bin++)
+        {
+            if (destination->resistance_edges[bin] != source->resistance_edges[bin])
+            {
+                is_valid = 0U;
+            }
+        }
+
+        if (is_valid != 0U)
+        {
+            for (bin = 0U; bin < destination->bin_count; bin++)
+            {
+                destination->counts[bin] += source->counts[bin];
+            }
+
+            destination->underflow += source->underflow;
+            destination->overflow += source->overflow;
+        }
+    }
+
+    return is_valid;
+}
+
+
+/**
+ * @brief Computes temperature statistics from a histogram of raw ADC codes.
+ *
+ * @details
+ * Each occupied code is converted once, so the cost depends on the number of distinct codes and
+ * not on the number of samples. Mean and standard deviation use a weighted Welford update.
+ * Percentiles use the nearest-rank method; since temperature increases with the code, they are
+ * found by a cumulative scan of the counts and cost one extra conversion each.
+ *
+ * @param[in]  adc                      ADC transfer function and sensor type.
+ * @param[in]  code_counts              Number of samples of each code.
+ * @param[in]  code_count               Number of codes in @p code_counts (e.g. 65536 for 16 bits).
+ * @param[in]  percentiles              Requested percentiles in the range 0 to 100, or @c NULL.
+ * @param[out] percentile_temperatures  Temperature of each requested percentile, or @c NULL.
+ * @param[in]  percentile_count         Number of requested percentiles.
+ * @param[out] stats                    Resulting statistics.
+ *
+ * @return 1 if at least one sample was in range, 0 otherwise or if an argument is invalid.
+ */
+uint8_t RTD_Stats_FromCodeHistogram(const RTD_AdcDescriptor_t *adc, const uint64_t *code_counts, uint32_t code_count,
+                                    const double *percentiles, double *percentile_temperatures, uint32_t percentile_count,
+                                    RTD_TemperatureStats_t *stats)
+{
+    uint8_t is_valid = 0U;
+    uint32_t code = 0U, first_code = 0U, last_code = 0U, percentile = 0U;
+    uint64_t count = 0U, rank = 0U, cumulative = 0U;
+    double resistance = 0.0, temperature = 0.0, delta = 0.0, mean = 0.0, m2 = 0.0;
+
+    if ( (adc != NULL) && (code_counts != NULL) && (stats != NULL) && (adc->resistance_per_code > 0.0) &&
+         ((percentile_count == 0U) || ((percentiles != NULL) && (percentile_temperatures != NULL))) )
+    {
+        stats->sample_count = 0U;
+        stats->failed_count = 0U;
+        stats->min = RTD_CONVERSION_FAILED;
+        stats->max = RTD_CONVERSION_FAILED;
+
+        for (code = 0U; code < code_count; code++)
+        {
+            count = code_counts[code];
+
+            if (count != 0U)
+            {
+                resistance = adc->resistance_offset + ((double)code * adc->resistance_per_code);
+
+                if (RTD_CalculateTemperatureBatch(adc->sensor_type, &resistance, &temperature, 1U) == 0U)
+                {
+                    stats->failed_count += count;
+                }
+                else
+                {
+                    if (stats->sample_count == 0U)
+                    {
+                        first_code = code;
+                        stats->min = temperature;
+                    }
+
+                    last_code = code;
+                    stats->max = temperature;
+
+                    /* Weighted Welford update with weight = count */
+                    stats->sample_count += count;
+                    delta = temperature - mean;
+                    mean += ((double)count / (double)stats->sample_count) * delta;
+                    m2 += (double)count * delta * (temperature - mean);
+                }
+            }
+        }
+
+        if (stats->sample_count != 0U)
+        {
+            stats->mean = mean;
+            stats->std_deviation = sqrt(m2 / (double)stats->sample_count);
+            is_valid = 1U;
+        }
+        else
+        {
+            stats->mean = RTD_CONVERSION_FAILED;
+            stats->std_deviation = RTD_CONVERSION_FAILED;
+        }
+
+        for (percentile = 0U; percentile < percentile_count; percentile++)
+        {
+            percentile_temperatures[percentile] = RTD_CONVERSION_FAILED;
+
+            if ( (is_valid != 0U) && (percentiles[percentile] >= 0.0) && (percentiles[percentile] <= 100.0) )
+            {
+                /* Nearest rank; the codes between first_code and last_code are all in range */
+                rank = (uint64_t)ceil((percentiles[percentile] / 100.0) * (double)stats->sample_count);
+                rank = (rank == 0U) ? 1U : rank;
+                rank = (rank > stats->sample_count) ? stats->sample_count : rank;
+                cumulative = 0U;
+
+                for (code = first_code; (code <= last_code) && (cumulative < rank); code++)
+                {
+                    cumulative += code_counts[code];
+                }
+
+                resistance = adc->resistance_offset + ((double)(code - 1U) * adc->resistance_per_code);
+                (void)RTD_CalculateTemperatureBatch(adc->sensor_type, &resistance, &percentile_temperatures[percentile], 1U);
+            }
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Initializes a rollup stage with empty windows.
+ *
+ * @param[out] rollup           Rollup stage to initialize.
+ * @param[in]  count            Storage for @p level_count * @p channel_count sample counts.
+ * @param[in]  failed           Storage for @p level_count * @p channel_count failure counts.
+ * @param[in]  mean             Storage for @p level_count * @p channel_count means.
+ * @param[in]  m2               Storage for @p level_count * @p channel_count squared deviations.
+ * @param[in]  min              Storage for @p level_count * @p channel_count minimums.
+ * @param[in]  max              Storage for @p level_count * @p channel_count maximums.
+ * @param[in]  channel_count    Number of channels.
+ * @param[in]  periods          Window length of each level in timestamp units, ascending, each a
+ *                              multiple of the previous one (e.g. 1000, 60000, 3600000 ms).
+ * @param[in]  level_count      Number of levels, 1 to @c RTD_ROLLUP_MAX_LEVELS.
+ * @param[in]  records          Record buffer. One closed window of level L can emit up to
+ *                              @p channel_count records, so size it accordingly.
+ * @param[in]  record_capacity  Number of elements of @p records.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Rollup_Init(RTD_Rollup_t *rollup, double *count, double *failed, double *mean, double *m2, double *min, double *max,
+                        uint32_t channel_count, const uint64_t *periods, uint32_t level_count, RTD_RollupRecord_t *records,
+                        uint32_t record_capacity)
+{
+    uint8_t is_valid = 0U;
+    uint32_t level = 0U;
+    size_t index = 0U;
+
+    if ( (rollup != NULL) && (count != NULL) && (failed != NULL) && (mean != NULL) && (m2 != NULL) && (min != NULL) && (max != NULL) &&
+         (periods != NULL) && (records != NULL) && (level_count >= 1U) && (level_count <= RTD_ROLLUP_MAX_LEVELS) && (periods[0] != 0U) )
+    {
+        is_valid = 1U;
+
+        for (level = 1U; level < level_count; level++)
+        {
+            if ( (periods[level] <= periods[level - 1U]) || ((periods[level] % periods[level - 1U]) != 0U) )
+            {
+                is_valid = 0U;
+            }
+        }
+    }
+
+    if (is_valid != 0U)
+    {
+        for (index = 0U; index < ((size_t)level_count * channel_count); index++)
+        {
+            count[index] = 0.0;
+            failed[index] = 0.0;
+            mean[index] = 0.0;
+            m2[index] = 0.0;
+            min[index] = HUGE_VAL;
+            max[index] = -HUGE_VAL;
+        }
+
+        for (level = 0U; level < level_count; level++)
+        {
+            rollup->period[level] = periods[level];
+            rollup->start[level] = 0U;
+        }
+
+        rollup->count = count;
+        rollup->failed = failed;
+        rollup->mean = mean;
+        rollup->m2 = m2;
+        rollup->min = min;
+        rollup->max = max;
+        rollup->channel_count = channel_count;
+        rollup->level_count = level_count;
+        rollup->started = 0U;
+        rollup->records = records;
+        rollup->record_capacity = record_capacity;
+        rollup->record_count = 0U;
+        rollup->dropped = 0U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Adds one frame of temperatures, closing the windows that ended before it.
+ *
+ * @details
+ * The Welford update runs across channels in blocks that stay in L1 cache and vectorizes.
+ * Temperatures equal to @c RTD_CONVERSION_FAILED are counted as failures.
+ *
+ * @param[in,out] rollup        Rollup stage.
+ * @param[in]     timestamp     Timestamp of the frame.
+ * @param[in]     temperatures  @c channel_count temperatures in degrees Celsius, one per channel.
+ *
+ * @return Number of records appended by this call.
+ */
+uint32_t RTD_Rollup_AddFrame(RTD_Rollup_t *rollup, uint64_t timestamp, const double *temperatures)
+{
+    uint32_t first = 0U, length = 0U, appended = 0U;
+
+    if ( (rollup != NULL) && (temperatures != NULL) )
+    {
+        appended = RTD_RollupAdvance(rollup, timestamp);
+
+        for (first = 0U; first < rollup->channel_count; first += length)
+        {
+            length = ((rollup->channel_count - first) < RTD_ROLLUP_BLOCK_SIZE) ? (rollup->channel_count - first) : RTD_ROLLUP_BLOCK_SIZE;
+            RTD_RollupAddBlock(rollup, &temperatures[first], first, length);
+        }
+    }
+
+    return appended;
+}
+
+/**
+ * @brief Adds samples of arbitrary channels in timestamp order.
+ *
+ * @details
+ * Samples of channels beyond @c channel_count are ignored. A sample older than the open window
+ * is added to the open window.
+ *
+ * @param[in,out] rollup        Rollup stage.
+ * @param[in]     timestamps    Timestamp of each sample.
+ * @param[in]     channels      Channel number of each sample.
+ * @param[in]     temperatures  Temperature of each sample in degrees Celsius.
+ * @param[in]     count         Number of samples.
+ *
+ * @return Number of records appended by this call.
+ */
+uint32_t RTD_Rollup_AddSamples(RTD_Rollup_t *rollup, const uint64_t *timestamps, const uint32_t *channels, const double *temperatures,
+                               uint32_t count)
+{
+    uint32_t index = 0U, appended = 0U;
+
+    if ( (rollup != NULL) && (timestamps != NULL) && (channels != NULL) && (temperatures != NULL) )
+    {
+        for (index = 0U; index < count; index++)
+        {
+            if (channels[index] < rollup->channel_count)
+            {
+                appended += RTD_RollupAdvance(rollup, timestamps[index]);
+                RTD_RollupAddBlock(rollup, &temperatures[index], channels[index], 1U);
+            }
+        }
+    }
+
+    return appended;
+}
+
+/**
+ * @brief Closes the open windows of all levels (e.g. at shutdown).
+ *
+ * @param[in,out] rollup  Rollup stage.
+ *
+ * @return Number of records appended by this call.
+ */
+uint32_t RTD_Rollup_Flush(RTD_Rollup_t *rollup)
+{
+    uint32_t level = 0U, appended = 0U;
+
+    if ( (rollup != NULL) && (rollup->started != 0U) )
+    {
+        for (level = 0U; level < rollup->level_count; level++)
+        {
+            appended += RTD_RollupClose(rollup, level);
+        }
+
+        /* The next sample aligns the windows again */
+        rollup->started = 0U;
+    }
+
+    return appended;
+}
+
+/**
+ * @brief Marks all records as read.
+ *
+ * @param[in,out] rollup  Rollup stage.
+ */
+void RTD_Rollup_ClearRecords(RTD_Rollup_t *rollup)
+{
+    if (rollup != NULL)
+    {
+        rollup->record_count = 0U;
+    }
+}
+
+
+/* platinum_rtd_stats.c */
@@ -0,0 +1,275 @@
+/**
+ * @file    platinum_rtd_stats.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Temperature statistics for platinum RTD data computed in the resistance domain.
+ *
+ * @details
+ * This file provides temperature histograms whose bin edges are mapped to resistance once with
+ * @c RTD_CalculateResistance. Raw resistance streams are then binned directly with a branch-free
+ * binary search, so the inverse conversion never runs per sample. Histograms built on separate
+ * threads over the same edges can be merged. Statistics of long windows are computed from
+ * histograms of raw ADC codes by converting each occupied code once.
+ *
+ * A rollup stage keeps per-channel min/max/mean/standard deviation accumulators for a cascade
+ * of time windows (e.g. 1 s, 1 min, 1 h). Samples are added once with a Welford update; when a
+ * window ends its statistics are emitted as records and merged into the next level, so longer
+ * windows never re-read the samples.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_STATS_H
+#define _PLATINUM_RTD_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Largest number of window levels of a rollup stage */
+#define  RTD_ROLLUP_MAX_LEVELS  4U    /**< e.g. 1 s, 1 min, 1 h, 1 day */
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/**
+ * @brief Temperature histogram binned in the resistance domain.
+ *
+ * @details
+ * Bin i counts resistances in [resistance_edges[i], resistance_edges[i + 1]), which corresponds
+ * to temperatures in [T_i, T_(i+1)) of the edges given at initialization.
+ */
+typedef struct
+{
+    double *resistance_edges;    /**< bin_count + 1 ascending edges in ohms           */
+    uint64_t *counts;            /**< Sample count of each bin                         */
+    uint32_t bin_count;          /**< Number of bins                                   */
+    uint64_t underflow;          /**< Samples below the first edge (or not a number)   */
+    uint64_t overflow;           /**< Samples at or above the last edge                */
+} RTD_Histogram_t;
+
+/** @brief Linear ADC transfer function of an RTD channel: R = offset + code * resistance_per_code. */
+typedef struct
+{
+    uint16_t sensor_type;          /**< RTD sensor type                           */
+    double resistance_offset;      /**< Resistance at code 0 (ohms)                */
+    double resistance_per_code;    /**< Resistance step of one code (ohms, > 0)    */
+} RTD_AdcDescriptor_t;
+
+/** @brief Temperature statistics of a sample window. */
+typedef struct
+{
+    uint64_t sample_count;     /**< Samples included in the statistics               */
+    uint64_t failed_count;     /**< Samples whose code is outside the sensor range   */
+    double mean;               /**< Mean temperature (°C)                            */
+    double std_deviation;      /**< Population standard deviation (K)                */
+    double min;                /**< Minimum temperature (°C)                         */
+    double max;                /**< Maximum temperature (°C)                         */
+} RTD_TemperatureStats_t;
+
+/** @brief Statistics of one channel over one closed window. */
+typedef struct
+{
+    uint64_t start;                  /**< Timestamp at which the window starts               */
+    uint32_t channel;                /**< Channel number                                     */
+    uint32_t level;                  /**< Window level (0 = shortest)                        */
+    RTD_TemperatureStats_t stats;    /**< Statistics (failed_count: conversion failures)     */
+} RTD_RollupRecord_t;
+
+/**
+ * @brief Cascading window accumulators of all channels (structure-of-arrays).
+ *
+ * @details
+ * Every accumulator array holds level_count * channel_count elements; element
+ * level * channel_count + channel belongs to one channel and level. Windows are aligned to
+ * multiples of their period in timestamp units, and every period is a multiple of the one below,
+ * so each boundary of a level is also a boundary of all shorter levels. Closed windows are
+ * appended to @c records until the caller clears them with @c RTD_Rollup_ClearRecords.
+ */
+typedef struct
+{
+    double *count;                                /**< Valid samples (double to keep the update vectorizable) */
+    double *failed;                               /**< Samples equal to @c RTD_CONVERSION_FAILED              */
+    double *mean;                                 /**< Running mean (°C)                                      */
+    double *m2;                                   /**< Sum of squared deviations from the mean (K^2)          */
+    double *min;                                  /**< Minimum (°C)                                           */
+    double *max;                                  /**< Maximum (°C)                                           */
+    uint32_t channel_count;                       /**< Number of channels                                     */
+    uint32_t level_count;                         /**< Number of window levels                                */
+    uint64_t period[RTD_ROLLUP_MAX_LEVELS];       /**< Window length of each level (timestamp units)          */
+    uint64_t start[RTD_ROLLUP_MAX_LEVELS];        /**< Start of the open window of each level                 */
+    uint8_t started;                              /**< 1 once the first timestamp has aligned the windows     */
+    RTD_RollupRecord_t *records;                  /**< Caller-provided record buffer                          */
+    uint32_t record_capacity;                     /**< Number of elements of @c records                       */
+    uint32_t record_count;                        /**< Records waiting to be read                             */
+    uint64_t dropped;                             /**< Records lost because the buffer was full               */
+} RTD_Rollup_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes an empty histogram from temperature bin edges.
+ *
+ * @param[out] histogram          Histogram to initialize.
+ * @param[in]  sensor_type        The RTD sensor type of the binned data.
+ * @param[in]  temperature_edges  @p bin_count + 1 strictly ascending edges in degrees Celsius,
+ *                                within -200°C to +850°C.
+ * @param[in]  bin_count          Number of bins (>= 1).
+ * @param[in]  resistance_edges   Storage for @p bin_count + 1 resistance edges.
+ * @param[in]  counts             Storage for @p bin_count counters.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Histogram_Init(RTD_Histogram_t *histogram, uint16_t sensor_type, const double *temperature_edges, uint32_t bin_count,
+                           double *resistance_edges, uint64_t *counts);
+
+/**
+ * @brief Clears all counters of a histogram.
+ *
+ * @param[in,out] histogram  Histogram.
+ */
+void RTD_Histogram_Reset(RTD_Histogram_t *histogram);
+
+/**
+ * @brief Adds raw resistance samples to a histogram.
+ *
+ * @details
+ * Each sample is located with a branch-free binary search over the resistance edges
+ * (ceil(log2(bin_count + 1)) steps); no temperature conversion is performed.
+ *
+ * @param[in,out] histogram    Histogram.
+ * @param[in]     resistances  Measured resistances in ohms.
+ * @param[in]     count        Number of samples.
+ */
+void RTD_Histogram_Add(RTD_Histogram_t *histogram, const double *resistances, uint32_t count);
+
+/**
+ * @brief Adds the counts of one histogram to another.
+ *
+ * @details
+ * Used to combine per-thread histograms. Both histograms must have identical edges.
+ *
+ * @param[in,out] destination  Histogram receiving the counts.
+ * @param[in]     source       Histogram to add.
+ *
+ * @return 1 on success, 0 if the histograms are incompatible.
+ */
+uint8_t RTD_Histogram_Merge(RTD_Histogram_t *destination, const RTD_Histogram_t *source);
+
+
+/**
+ * @brief Computes temperature statistics from a histogram of raw ADC codes.
+ *
+ * @details
+ * Each occupied code is converted once, so the cost depends on the number of distinct codes and
+ * not on the number of samples. Mean and standard deviation use a weighted Welford update.
+ * Percentiles use the nearest-rank method; since temperature increases with the code, they are
+ * found by a cumulative scan of the counts and cost one extra conversion each.
+ *
+ * @param[in]  adc                      ADC transfer function and sensor type.
+ * @param[in]  code_counts              Number of samples of each code.
+ * @param[in]  code_count               Number of codes in @p code_counts (e.g. 65536 for 16 bits).
+ * @param[in]  percentiles              Requested percentiles in the range 0 to 100, or @c NULL.
+ * @param[out] percentile_temperatures  Temperature of each requested percentile, or @c NULL.
+ * @param[in]  percentile_count         Number of requested percentiles.
+ * @param[out] stats                    Resulting statistics.
+ *
+ * @return 1 if at least one sample was in range, 0 otherwise or if an argument is invalid.
+ */
+uint8_t RTD_Stats_FromCodeHistogram(const RTD_AdcDescriptor_t *adc, const uint64_t *code_counts, uint32_t code_count,
+                                    const double *percentiles, double *percentile_temperatures, uint32_t percentile_count,
+                                    RTD_TemperatureStats_t *stats);
+
+/**
+ * @brief Initializes a rollup stage with empty windows.
+ *
+ * @param[out] rollup           Rollup stage to initialize.
+ * @param[in]  count            Storage for @p level_count * @p channel_count sample counts.
+ * @param[in]  failed           Storage for @p level_count * @p channel_count failure counts.
+ * @param[in]  mean             Storage for @p level_count * @p channel_count means.
+ * @param[in]  m2               Storage for @p level_count * @p channel_count squared deviations.
+ * @param[in]  min              Storage for @p level_count * @p channel_count minimums.
+ * @param[in]  max              Storage for @p level_count * @p channel_count maximums.
+ * @param[in]  channel_count    Number of channels.
+ * @param[in]  periods          Window length of each level in timestamp units, ascending, each a
+ *                              multiple of the previous one (e.g. 1000, 60000, 3600000 ms).
+ * @param[in]  level_count      Number of levels, 1 to @c RTD_ROLLUP_MAX_LEVELS.
+ * @param[in]  records          Record buffer. One closed window of level L can emit up to
+ *                              @p channel_count records, so size it accordingly.
+ * @param[in]  record_capacity  Number of elements of @p records.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Rollup_Init(RTD_Rollup_t *rollup, double *count, double *failed, double *mean, double *m2, double *min, double *max,
+                        uint32_t channel_count, const uint64_t *periods, uint32_t level_count, RTD_RollupRecord_t *records,
+                        uint32_t record_capacity);
+
+/**
+ * @brief Adds one frame of temperatures, closing the windows that ended before it.
+ *
+ * @details
+ * The Welford update runs across channels in blocks that stay in L1 cache and vectorizes.
+ * Temperatures equal to @c RTD_CONVERSION_FAILED are counted as failures.
+ *
+ * @param[in,out] rollup        Rollup stage.
+ * @param[in]     timestamp     Timestamp of the frame.
+ * @param[in]     temperatures  @c channel_count temperatures in degrees Celsius, one per channel.
+ *
+ * @return Number of records appended by this call.
+ */
+uint32_t RTD_Rollup_AddFrame(RTD_Rollup_t *rollup, uint64_t timestamp, const double *temperatures);
+
+/**
+ * @brief Adds samples of arbitrary channels in timestamp order.
+ *
+ * @details
+ * Samples of channels beyond @c channel_count are ignored. A sample older than the open window
+ * is added to the open window.
+ *
+ * @param[in,out] rollup        Rollup stage.
+ * @param[in]     timestamps    Timestamp of each sample.
+ * @param[in]     channels      Channel number of each sample.
+ * @param[in]     temperatures  Temperature of each sample in degrees Celsius.
+ * @param[in]     count         Number of samples.
+ *
+ * @return Number of records appended by this call.
+ */
+uint32_t RTD_Rollup_AddSamples(RTD_Rollup_t *rollup, const uint64_t *timestamps, const uint32_t *channels, const double *temperatures,
+                               uint32_t count);
+
+/**
+ * @brief Closes the open windows of all levels (e.g. at shutdown).
+ *
+ * @param[in,out] rollup  Rollup stage.
+ *
+ * @return Number of records appended by this call.
+ */
+uint32_t RTD_Rollup_Flush(RTD_Rollup_t *rollup);
+
+/**
+ * @brief Marks all records as read.
+ *
+ * @param[in,out] rollup  Rollup stage.
+ */
+void RTD_Rollup_ClearRecords(RTD_Rollup_t *rollup);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_stats.h */
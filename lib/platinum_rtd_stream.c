@@ -0,0 +1,789 @@
+/**
+ * @file    platinum_rtd_stream.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Streaming conversion pipeline for multi-channel platinum RTD acquisition.
+ *
+ * @details
+ * This file implements the bounded lock-free SPSC sample rings and the batch conversion
+ * pipeline stage declared in @c platinum_rtd_stream.h.
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#if defined(RTD_LATEST_POSIX_SHM) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE  200809L    ///< shm_open, mmap
+#endif
+
+#include "platinum_rtd_stream.h"    ///< Header file for RTD streaming functions.
+#include <string.h>                 ///< memcpy
+
+#if defined(RTD_LATEST_POSIX_SHM)
+#include <fcntl.h>                  ///< O_x flags
+#include <sys/mman.h>               ///< shm_open, mmap, munmap
+#include <sys/stat.h>               ///< fstat
+#include <unistd.h>                 ///< ftruncate, close
+#endif
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @name Ring Index Access
+ *  The producer publishes @c head with release semantics after writing a slot, and the consumer
+ *  publishes @c tail with release semantics after reading one.
+ *  @{
+ */
+#if defined(RTD_STREAM_C11_ATOMICS)
+#define  RTD_LOAD_ACQUIRE(index)          atomic_load_explicit(&(index), memory_order_acquire)
+#define  RTD_LOAD_RELAXED(index)          atomic_load_explicit(&(index), memory_order_relaxed)
+#define  RTD_STORE_RELEASE(index, value)  atomic_store_explicit(&(index), (value), memory_order_release)
+#define  RTD_STORE_RELAXED(index, value)  atomic_store_explicit(&(index), (value), memory_order_relaxed)
+#define  RTD_FENCE_ACQUIRE()              atomic_thread_fence(memory_order_acquire)
+#define  RTD_FENCE_RELEASE()              atomic_thread_fence(memory_order_release)
+#else
+#define  RTD_LOAD_ACQUIRE(index)          (index)
+#define  RTD_LOAD_RELAXED(index)          (index)
+#define  RTD_STORE_RELEASE(index, value)  ((index) = (value))
+#define  RTD_STORE_RELAXED(index, value)  ((index) = (value))
+#define  RTD_FENCE_ACQUIRE()
+#define  RTD_FENCE_RELEASE()
+#endif
+/** @} */
+
+
+/* ---------------------------------- Private Functions ------------------------------- */
+
+/**
+ * @brief Returns the direct-mapped cache slot of a resistance and descriptor index.
+ *
+ * @return Slot index in the range 0 to (entry_count - 1).
+ */
+static uint32_t RTD_GetCacheSlot(const RTD_ConversionCache_t *cache, double resistance, uint8_t descriptor_index)
+{
+    uint64_t key = 0U;
+
+    (void)memcpy(&key, &resistance, sizeof(key));
+
+    /* Fibonacci hashing of the bit pattern; quantized resistances differ mostly in low mantissa bits */
+    key ^= (key >> 32U) ^ (uint64_t)descriptor_index;
+    key *= 0x9E3779B97F4A7C15ULL;
+
+    return (uint32_t)(key >> 32U) & (cache->entry_count - 1U);
+}
+
+/**
+ * @brief Converts one batch of a pipeline, serving repeated resistances from its cache.
+ *
+ * @details
+ * Cache misses are gathered and converted in a single call of @c RTD_CalculateTemperatureMixed,
+ * then stored in both cache layers.
+ */
+static void RTD_ConvertCached(RTD_Pipeline_t *pipeline, const RTD_Sample_t *samples, const uint8_t *descriptor_indices,
+                              double *values, uint32_t count)
+{
+    RTD_ConversionCache_t *cache = pipeline->cache;
+    uint32_t index = 0U, channel = 0U, slot = 0U, missed = 0U, miss = 0U;
+    uint8_t is_hit = 0U;
+    uint32_t miss_indices[RTD_STREAM_BATCH_SIZE];
+    double miss_values[RTD_STREAM_BATCH_SIZE];
+    uint8_t miss_descriptors[RTD_STREAM_BATCH_SIZE];
+
+    for (index = 0U; index < count; index++)
+    {
+        channel = samples[index].channel;
+        is_hit = 0U;
+
+        if ( (channel < cache->channel_count) && (values[index] == cache->last_resistance[channel]) )
+        {
+            values[index] = cache->last_temperature[channel];
+            cache->channel_hits++;
+            is_hit = 1U;
+        }
+        else if ( (cache->entry_count != 0U) && (descriptor_indices[index] != RTD_INVALID_DESCRIPTOR) )
+        {
+            slot = RTD_GetCacheSlot(cache, values[index], descriptor_indices[index]);
+
+            if ( (cache->entry_descriptor[slot] == descriptor_indices[index]) && (cache->entry_resistance[slot] == values[index]) )
+            {
+                if (channel < cache->channel_count)
+                {
+                    cache->last_resistance[channel] = values[index];
+                    cache->last_temperature[channel] = cache->entry_temperature[slot];
+                }
+
+                values[index] = cache->entry_temperature[slot];
+                cache->entry_hits++;
+                is_hit = 1U;
+            }
+        }
+        else
+        {
+            /* No cache layer applies */
+        }
+
+        if (is_hit == 0U)
+        {
+            miss_indices[missed] = index;
+            miss_values[missed] = values[index];
+            miss_descriptors[missed] = descriptor_indices[index];
+            missed++;
+        }
+    }
+
+    (void)RTD_CalculateTemperatureMixed(pipeline->descriptors, miss_descriptors, miss_values, miss_values, missed);
+
+    for (miss = 0U; miss < missed; miss++)
+    {
+        index = miss_indices[miss];
+        channel = samples[index].channel;
+
+        if (channel < cache->channel_count)
+        {
+            cache->last_resistance[channel] = values[index];
+            cache->last_temperature[channel] = miss_values[miss];
+        }
+
+        if ( (cache->entry_count != 0U) && (miss_descriptors[miss] != RTD_INVALID_DESCRIPTOR) )
+        {
+            slot = RTD_GetCacheSlot(cache, values[index], miss_descriptors[miss]);
+            cache->entry_resistance[slot] = values[index];
+            cache->entry_temperature[slot] = miss_values[miss];
+            cache->entry_descriptor[slot] = miss_descriptors[miss];
+        }
+
+        values[index] = miss_values[miss];
+    }
+
+    cache->misses += missed;
+}
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Initializes an empty sample ring.
+ *
+ * @param[out] ring      Ring to initialize.
+ * @param[in]  buffer    Storage for @p capacity samples.
+ * @param[in]  capacity  Number of slots. Must be a power of two.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Ring_Init(RTD_Ring_t *ring, RTD_Sample_t *buffer, uint32_t capacity)
+{
+    uint8_t is_valid = 0U;
+
+    if ( (ring != NULL) && (buffer != NULL) && (capacity != 0U) && ((capacity & (capacity - 1U)) == 0U) )
+    {
+        ring->buffer = buffer;
+        ring->capacity = capacity;
+        RTD_STORE_RELEASE(ring->head, 0U);
+        RTD_STORE_RELEASE(ring->tail, 0U);
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Returns the number of samples waiting in a ring.
+ *
+ * @param[in] ring  Sample ring.
+ *
+ * @return Number of samples that can be popped.
+ */
+uint32_t RTD_Ring_GetCount(const RTD_Ring_t *ring)
+{
+    uint32_t count = 0U;
+
+    if (ring != NULL)
+    {
+        count = RTD_LOAD_ACQUIRE(ring->head) - RTD_LOAD_ACQUIRE(ring->tail);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the number of free slots in a ring.
+ *
+ * @param[in] ring  Sample ring.
+ *
+ * @return Number of samples that can be pushed.
+ */
+uint32_t RTD_Ring_GetSpace(const RTD_Ring_t *ring)
+{
+    uint32_t space = 0U;
+
+    if (ring != NULL)
+    {
+        space = ring->capacity - RTD_Ring_GetCount(ring);
+    }
+
+    return space;
+}
+
+/**
+ * @brief Pushes samples into a ring (producer side).
+ *
+ * @param[in,out] ring     Sample ring.
+ * @param[in]     samples  Samples to push.
+ * @param[in]     count    Number of samples.
+ *
+ * @return Number of samples pushed; fewer than @p count if the ring is full (backpressure).
+ */
+uint32_t RTD_Ring_Push(RTD_Ring_t *ring, const RTD_Sample_t *samples, uint32_t count)
+{
+    uint32_t head = 0U, tail = 0U, space = 0U, index = 0U;
+
+    if ( (ring != NULL) && (samples != NULL) )
+    {
+        head = RTD_LOAD_RELAXED(ring->head);
+        tail = RTD_LOAD_ACQUIRE(ring->tail);
+        space = ring->capacity - (head - tail);
+        count = (count < space) ? count : space;
+
+        for (index = 0U; index < count; index++)
+        {
+            ring->buffer[(head + index) & (ring->capacity - 1U)] = samples[index];
+        }
+
+        RTD_STORE_RELEASE(ring->head, head + count);
+    }
+    else
+    {
+        count = 0U;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Pops samples from a ring (consumer side).
+ *
+ * @param[in,out] ring         Sample ring.
+ * @param[out]    samples      Destination for the popped samples.
+ * @param[in]     max_samples  Maximum number of samples to pop.
+ *
+ * @return Number of samples popped.
+ */
+uint32_t RTD_Ring_Pop(RTD_Ring_t *ring, RTD_Sample_t *samples, uint32_t max_samples)
+{
+    uint32_t head = 0U, tail = 0U, count = 0U, index = 0U;
+
+    if ( (ring != NULL) && (samples != NULL) )
+    {
+        tail = RTD_LOAD_RELAXED(ring->tail);
+        head = RTD_LOAD_ACQUIRE(ring->head);
+        count = head - tail;
+        count = (count < max_samples) ? count : max_samples;
+
+        for (index = 0U; index < count; index++)
+        {
+            samples[index] = ring->buffer[(tail + index) & (ring->capacity - 1U)];
+        }
+
+        RTD_STORE_RELEASE(ring->tail, tail + count);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Initializes a streaming conversion stage.
+ *
+ * @param[out] pipeline             Pipeline to initialize.
+ * @param[in]  input                Ring of raw samples; the pipeline is its only consumer.
+ * @param[in]  output               Ring of converted samples; the pipeline is its only producer.
+ * @param[in]  descriptors          Sensor descriptor table.
+ * @param[in]  channel_descriptors  Descriptor index of each channel.
+ * @param[in]  channel_count        Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Pipeline_Init(RTD_Pipeline_t *pipeline, RTD_Ring_t *input, RTD_Ring_t *output,
+                          const RTD_DescriptorTable_t *descriptors, const uint8_t *channel_descriptors, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+
+    if ( (pipeline != NULL) && (input != NULL) && (output != NULL) && (descriptors != NULL) && (channel_descriptors != NULL) )
+    {
+        pipeline->input = input;
+        pipeline->output = output;
+        pipeline->descriptors = descriptors;
+        pipeline->channel_descriptors = channel_descriptors;
+        pipeline->channel_count = channel_count;
+        pipeline->latest = NULL;
+        pipeline->cache = NULL;
+        pipeline->change = NULL;
+        pipeline->rollup = NULL;
+        pipeline->samples_processed = 0U;
+        pipeline->samples_failed = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Drains the input ring through the batch kernel into the output ring.
+ *
+ * @details
+ * Converts at most @p max_samples samples in batches of @c RTD_STREAM_BATCH_SIZE, never more
+ * than the output ring can accept, so each call has a bounded cost. Samples of unknown channels
+ * or with out-of-range resistances are published with @c RTD_SAMPLE_CONVERSION_FAILED and a
+ * value of @c RTD_CONVERSION_FAILED; timestamps and channel numbers are passed through.
+ * If a conversion cache is attached, repeated resistances are served from it without conversion.
+ * If a latest-value table is attached, it is updated with every published sample.
+ * If a change detector is attached, change points are marked with @c RTD_SAMPLE_CHANGE_UP or
+ * @c RTD_SAMPLE_CHANGE_DOWN. If a rollup stage is attached, every sample is added to it.
+ *
+ * @param[in,out] pipeline     Pipeline stage.
+ * @param[in]     max_samples  Maximum number of samples to process in this call.
+ *
+ * @return Number of samples published to the output ring.
+ */
+uint32_t RTD_Pipeline_Process(RTD_Pipeline_t *pipeline, uint32_t max_samples)
+{
+    uint32_t published = 0U, budget = 0U, count = 0U, index = 0U, channel = 0U;
+    RTD_Sample_t samples[RTD_STREAM_BATCH_SIZE];
+    double values[RTD_STREAM_BATCH_SIZE];
+    uint8_t descriptor_indices[RTD_STREAM_BATCH_SIZE];
+    uint32_t channels[RTD_STREAM_BATCH_SIZE];
+    uint64_t timestamps[RTD_STREAM_BATCH_SIZE];
+    uint8_t changes[RTD_STREAM_BATCH_SIZE];
+
+    if (pipeline != NULL)
+    {
+        budget = RTD_Ring_GetSpace(pipeline->output);
+        budget = (budget < max_samples) ? budget : max_samples;
+
+        while (published < budget)
+        {
+            count = budget - published;
+            count = (count < RTD_STREAM_BATCH_SIZE) ? count : RTD_STREAM_BATCH_SIZE;
+            count = RTD_Ring_Pop(pipeline->input, samples, count);
+
+            if (count == 0U)
+            {
+                break;
+            }
+
+            for (index = 0U; index < count; index++)
+            {
+                channel = samples[index].channel;
+                channels[index] = channel;
+                timestamps[index] = samples[index].timestamp;
+                descriptor_indices[index] = (channel < pipeline->channel_count) ? pipeline->channel_descriptors[channel] : RTD_INVALID_DESCRIPTOR;
+                values[index] = samples[index].value;
+            }
+
+            if (pipeline->cache != NULL)
+            {
+                RTD_ConvertCached(pipeline, samples, descriptor_indices, values, count);
+            }
+            else
+            {
+                (void)RTD_CalculateTemperatureMixed(pipeline->descriptors, descriptor_indices, values, values, count);
+            }
+
+            for (index = 0U; index < count; index++)
+            {
+                samples[index].value = values[index];
+
+                if (values[index] == RTD_CONVERSION_FAILED)
+                {
+                    samples[index].status |= RTD_SAMPLE_CONVERSION_FAILED;
+                    pipeline->samples_failed++;
+                }
+            }
+
+            if (pipeline->change != NULL)
+            {
+                if (RTD_ChangeDetector_Update(pipeline->change, channels, values, changes, count) != 0U)
+                {
+                    for (index = 0U; index < count; index++)
+                    {
+                        samples[index].status |= ((changes[index] & RTD_CHANGE_UP) != 0U) ? RTD_SAMPLE_CHANGE_UP : 0U;
+                        samples[index].status |= ((changes[index] & RTD_CHANGE_DOWN) != 0U) ? RTD_SAMPLE_CHANGE_DOWN : 0U;
+                    }
+                }
+            }
+
+            if (pipeline->rollup != NULL)
+            {
+                (void)RTD_Rollup_AddSamples(pipeline->rollup, timestamps, channels, values, count);
+            }
+
+            if (pipeline->latest != NULL)
+            {
+                RTD_Latest_Update(pipeline->latest, samples, count);
+            }
+
+            (void)RTD_Ring_Push(pipeline->output, samples, count);
+            published += count;
+        }
+
+        pipeline->samples_processed += published;
+    }
+
+    return published;
+}
+
+/**
+ * @brief Attaches a latest-value table that the pipeline updates after each conversion.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     latest    Latest-value table, or @c NULL to detach. The pipeline becomes its only writer.
+ */
+void RTD_Pipeline_AttachLatest(RTD_Pipeline_t *pipeline, RTD_LatestTable_t *latest)
+{
+    if (pipeline != NULL)
+    {
+        pipeline->latest = latest;
+    }
+}
+
+/**
+ * @brief Initializes an empty conversion cache.
+ *
+ * @param[out] cache              Cache to initialize.
+ * @param[in]  last_resistance    Storage for @p channel_count last resistances, or @c NULL.
+ * @param[in]  last_temperature   Storage for @p channel_count last temperatures, or @c NULL.
+ * @param[in]  channel_count      Number of channels of the per-channel layer (0 disables it).
+ * @param[in]  entry_resistance   Storage for @p entry_count entry keys, or @c NULL.
+ * @param[in]  entry_temperature  Storage for @p entry_count entry values, or @c NULL.
+ * @param[in]  entry_descriptor   Storage for @p entry_count entry descriptor indices, or @c NULL.
+ * @param[in]  entry_count        Number of direct-mapped entries, a power of two (0 disables the layer).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Cache_Init(RTD_ConversionCache_t *cache, double *last_resistance, double *last_temperature, uint32_t channel_count,
+                       double *entry_resistance, double *entry_temperature, uint8_t *entry_descriptor, uint32_t entry_count)
+{
+    uint8_t is_valid = 0U;
+    uint32_t index = 0U;
+
+    if ( (cache != NULL) &&
+         ((channel_count == 0U) || ((last_resistance != NULL) && (last_temperature != NULL))) &&
+         ((entry_count == 0U) || ((entry_resistance != NULL) && (entry_temperature != NULL) && (entry_descriptor != NULL) &&
+                                  ((entry_count & (entry_count - 1U)) == 0U))) )
+    {
+        /* -HUGE_VAL never equals a measured resistance, so empty entries never hit */
+        for (index = 0U; index < channel_count; index++)
+        {
+            last_resistance[index] = -HUGE_VAL;
+            last_temperature[index] = RTD_CONVERSION_FAILED;
+        }
+
+        for (index = 0U; index < entry_count; index++)
+        {
+            entry_resistance[index] = -HUGE_VAL;
+            entry_temperature[index] = RTD_CONVERSION_FAILED;
+            entry_descriptor[index] = RTD_INVALID_DESCRIPTOR;
+        }
+
+        cache->last_resistance = last_resistance;
+        cache->last_temperature = last_temperature;
+        cache->channel_count = channel_count;
+        cache->entry_resistance = entry_resistance;
+        cache->entry_temperature = entry_temperature;
+        cache->entry_descriptor = entry_descriptor;
+        cache->entry_count = entry_count;
+        cache->channel_hits = 0U;
+        cache->entry_hits = 0U;
+        cache->misses = 0U;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Returns the fraction of samples served from a conversion cache.
+ *
+ * @param[in] cache  Conversion cache.
+ *
+ * @return Hit rate in the range 0 to 1 (0 if no sample was looked up yet).
+ */
+double RTD_Cache_GetHitRate(const RTD_ConversionCache_t *cache)
+{
+    double hit_rate = 0.0;
+    uint64_t hits = 0U;
+
+    if (cache != NULL)
+    {
+        hits = cache->channel_hits + cache->entry_hits;
+
+        if ((hits + cache->misses) != 0U)
+        {
+            hit_rate = (double)hits / (double)(hits + cache->misses);
+        }
+    }
+
+    return hit_rate;
+}
+
+/**
+ * @brief Attaches a conversion cache that the pipeline consults before converting.
+ *
+ * @details
+ * The cache must have been initialized for the descriptor table of this pipeline and must not
+ * be shared with another pipeline.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     cache     Conversion cache, or @c NULL to detach.
+ */
+void RTD_Pipeline_AttachCache(RTD_Pipeline_t *pipeline, RTD_ConversionCache_t *cache)
+{
+    if (pipeline != NULL)
+    {
+        pipeline->cache = cache;
+    }
+}
+
+/**
+ * @brief Attaches a change detector that the pipeline updates with every converted sample.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     detector  Change detector indexed by channel number, or @c NULL to detach. The
+ *                          pipeline becomes its only writer.
+ */
+void RTD_Pipeline_AttachChangeDetector(RTD_Pipeline_t *pipeline, RTD_ChangeDetector_t *detector)
+{
+    if (pipeline != NULL)
+    {
+        pipeline->change = detector;
+    }
+}
+
+/**
+ * @brief Attaches a rollup stage that the pipeline feeds with every converted sample.
+ *
+ * @details
+ * Closed windows accumulate in the records of the rollup stage. Read and clear them between
+ * calls to @c RTD_Pipeline_Process on the thread that runs the pipeline.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     rollup    Rollup stage indexed by channel number, or @c NULL to detach.
+ */
+void RTD_Pipeline_AttachRollup(RTD_Pipeline_t *pipeline, RTD_Rollup_t *rollup)
+{
+    if (pipeline != NULL)
+    {
+        pipeline->rollup = rollup;
+    }
+}
+
+/**
+ * @brief Initializes a latest-value table with every channel marked @c RTD_SAMPLE_NO_DATA.
+ *
+ * @param[out] table          Table to initialize.
+ * @param[in]  slots          Storage for @p channel_count slots, aligned to @c RTD_CACHE_LINE_SIZE.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Latest_Init(RTD_LatestTable_t *table, RTD_LatestSlot_t *slots, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+    uint32_t channel = 0U;
+
+    if ( (table != NULL) && (slots != NULL) )
+    {
+        for (channel = 0U; channel < channel_count; channel++)
+        {
+            RTD_STORE_RELAXED(slots[channel].sequence, 0U);
+            slots[channel].status = RTD_SAMPLE_NO_DATA;
+            slots[channel].timestamp = 0U;
+            slots[channel].temperature = RTD_CONVERSION_FAILED;
+        }
+
+        RTD_FENCE_RELEASE();
+        table->slots = slots;
+        table->channel_count = channel_count;
+        is_valid = 1U;
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Stores samples in a latest-value table (single writer).
+ *
+ * @param[in,out] table    Latest-value table.
+ * @param[in]     samples  Converted samples; samples of unknown channels are ignored.
+ * @param[in]     count    Number of samples.
+ */
+void RTD_Latest_Update(RTD_LatestTable_t *table, const RTD_Sample_t *samples, uint32_t count)
+{
+    uint32_t index = 0U, sequence = 0U;
+    volatile RTD_LatestSlot_t *slot = NULL;
+
+    if ( (table != NULL) && (samples != NULL) )
+    {
+        for (index = 0U; index < count; index++)
+        {
+            if (samples[index].channel < table->channel_count)
+            {
+                slot = &table->slots[samples[index].channel];
+                sequence = RTD_LOAD_RELAXED(slot->sequence);
+
+                /* Odd sequence: readers discard any copy that overlaps this update */
+                RTD_STORE_RELAXED(slot->sequence, sequence + 1U);
+                RTD_FENCE_RELEASE();
+                slot->status = samples[index].status;
+                slot->timestamp = samples[index].timestamp;
+                slot->temperature = samples[index].value;
+                RTD_STORE_RELEASE(slot->sequence, sequence + 2U);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Reads the latest sample of a channel (wait-free).
+ *
+ * @details
+ * Makes a single attempt and never waits for the writer. If the slot was being updated during
+ * the copy the function returns 0 and the caller may simply try again.
+ *
+ * @param[in]  table    Latest-value table.
+ * @param[in]  channel  Channel number.
+ * @param[out] sample   Consistent snapshot of the slot (value is the temperature).
+ *
+ * @return 1 if @p sample holds a consistent snapshot, 0 otherwise.
+ */
+uint8_t RTD_Latest_Read(const RTD_LatestTable_t *table, uint32_t channel, RTD_Sample_t *sample)
+{
+    uint8_t is_consistent = 0U;
+    uint32_t sequence_before = 0U, sequence_after = 0U;
+    const volatile RTD_LatestSlot_t *slot = NULL;
+
+    if ( (table != NULL) && (sample != NULL) && (channel < table->channel_count) )
+    {
+        slot = &table->slots[channel];
+        sequence_before = RTD_LOAD_ACQUIRE(slot->sequence);
+        sample->channel = channel;
+        sample->status = slot->status;
+        sample->timestamp = slot->timestamp;
+        sample->value = slot->temperature;
+        RTD_FENCE_ACQUIRE();
+        sequence_after = RTD_LOAD_RELAXED(slot->sequence);
+
+        is_consistent = ( (sequence_before == sequence_after) && ((sequence_before & 1U) == 0U) ) ? 1U : 0U;
+    }
+
+    return is_consistent;
+}
+
+#if defined(RTD_LATEST_POSIX_SHM)
+
+/**
+ * @brief Creates (or replaces) a latest-value table in POSIX shared memory for writing.
+ *
+ * @param[out] table          Table to initialize.
+ * @param[in]  name           Shared-memory object name (e.g. "/rtd_latest").
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+uint8_t RTD_Latest_CreateShared(RTD_LatestTable_t *table, const char *name, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+    int descriptor = -1;
+    void *mapping = MAP_FAILED;
+    size_t size = (size_t)channel_count * sizeof(RTD_LatestSlot_t);
+
+    if ( (table != NULL) && (name != NULL) && (channel_count != 0U) )
+    {
+        descriptor = shm_open(name, O_CREAT | O_RDWR, 0644);
+
+        if (descriptor >= 0)
+        {
+            if (ftruncate(descriptor, (off_t)size) == 0)
+            {
+                mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+            }
+
+            (void)close(descriptor);
+        }
+
+        if (mapping != MAP_FAILED)
+        {
+            is_valid = RTD_Latest_Init(table, (RTD_LatestSlot_t *)mapping, channel_count);
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Maps an existing shared latest-value table read-only.
+ *
+ * @param[out] table          Table to initialize for reading with @c RTD_Latest_Read only.
+ * @param[in]  name           Shared-memory object name.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 on failure (also if the object is smaller than @p channel_count slots).
+ */
+uint8_t RTD_Latest_OpenShared(RTD_LatestTable_t *table, const char *name, uint32_t channel_count)
+{
+    uint8_t is_valid = 0U;
+    int descriptor = -1;
+    void *mapping = MAP_FAILED;
+    size_t size = (size_t)channel_count * sizeof(RTD_LatestSlot_t);
+    struct stat status;
+
+    if ( (table != NULL) && (name != NULL) && (channel_count != 0U) )
+    {
+        descriptor = shm_open(name, O_RDONLY, 0);
+
+        if (descriptor >= 0)
+        {
+            /* Mapping past the end of the object would raise SIGBUS on the first read */
+            if ( (fstat(descriptor, &status) == 0) && (status.st_size >= 0) && ((uintmax_t)status.st_size >= (uintmax_t)size) )
+            {
+                mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, descriptor, 0);
+            }
+
+            (void)close(descriptor);
+        }
+
+        if (mapping != MAP_FAILED)
+        {
+            table->slots = (RTD_LatestSlot_t *)mapping;
+            table->channel_count = channel_count;
+            is_valid = 1U;
+        }
+    }
+
+    return is_valid;
+}
+
+/**
+ * @brief Unmaps a shared latest-value table.
+ *
+ * @param[in,out] table  Table created by @c RTD_Latest_CreateShared or @c RTD_Latest_OpenShared.
+ */
+void RTD_Latest_CloseShared(RTD_LatestTable_t *table)
+{
+    if ( (table != NULL) && (table->slots != NULL) )
+    {
+        (void)munmap(table->slots, (size_t)table->channel_count * sizeof(RTD_LatestSlot_t));
+        table->slots = NULL;
+        table->channel_count = 0U;
+    }
+}
+
+#endif  /* RTD_LATEST_POSIX_SHM */
+
+
+/* platinum_rtd_stream.c */
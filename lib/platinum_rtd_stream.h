@@ -0,0 +1,412 @@
+/**
+ * @file    platinum_rtd_stream.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Streaming conversion pipeline for multi-channel platinum RTD acquisition.
+ *
+ * @details
+ * This file provides bounded, lock-free single-producer/single-consumer (SPSC) sample rings and
+ * a pipeline stage that drains raw (channel, timestamp, resistance) samples in batches, converts
+ * them with the mixed-sensor batch kernel and publishes the temperatures to an output ring.
+ * Full output rings stop the stage from draining its input, which propagates backpressure to
+ * the producer. Several producers are served by giving each one its own ring and pipeline.
+ * No memory is allocated and no threads are created: the caller provides all storage and runs
+ * @c RTD_Pipeline_Process from its own (optionally pinned) worker threads or main loop.
+ *
+ * A latest-value table keeps the most recent temperature of every channel in its own cache
+ * line, protected by a sequence counter (seqlock), so readers never block the pipeline. It can
+ * optionally live in POSIX shared memory to be mapped read-only by other processes.
+ *
+ * @note
+ * With a C11 compiler providing <stdatomic.h> the ring indices use acquire/release atomics and
+ * are safe across cores. Otherwise they fall back to @c volatile, which is sufficient only for
+ * single-core targets (e.g. an interrupt producer and a main-loop consumer).
+ *
+ * @warning
+ * Ensure the sensor type and input values are valid before calling the functions.
+ */
+
+
+#ifndef _PLATINUM_RTD_STREAM_H
+#define _PLATINUM_RTD_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "platinum_rtd_sensor.h"    ///< Conversion functions and sensor descriptors
+#include "platinum_rtd_diag.h"      ///< Change detector
+#include "platinum_rtd_stats.h"     ///< Rollup stage
+
+#if !defined(__cplusplus) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>              ///< C11 atomics
+#define  RTD_STREAM_C11_ATOMICS  1
+#endif
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Cache line size used to separate data written by different threads */
+#ifndef RTD_CACHE_LINE_SIZE
+#define  RTD_CACHE_LINE_SIZE  64U    /**< Cache line size in bytes */
+#endif
+
+
+/** @brief Number of samples converted per batch by @c RTD_Pipeline_Process */
+#ifndef RTD_STREAM_BATCH_SIZE
+#define  RTD_STREAM_BATCH_SIZE  32U    /**< Samples per batch (stack use ~1.5 KiB) */
+#endif
+
+
+/* Define RTD_LATEST_POSIX_SHM to build the POSIX shared-memory backing of latest-value tables. */
+
+
+/** @name Sample Status Flags
+ *  @{
+ */
+#define  RTD_SAMPLE_OK                 0x00U    /**< Sample converted successfully              */
+#define  RTD_SAMPLE_CONVERSION_FAILED  0x01U    /**< Resistance out of range or unknown channel */
+#define  RTD_SAMPLE_NO_DATA            0x02U    /**< No sample stored yet (latest-value table)  */
+#define  RTD_SAMPLE_CHANGE_UP          0x04U    /**< Change point: level has risen              */
+#define  RTD_SAMPLE_CHANGE_DOWN        0x08U    /**< Change point: level has fallen             */
+/** @} */
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/** @brief Ring index type (atomic when C11 atomics are available). */
+#if defined(RTD_STREAM_C11_ATOMICS)
+typedef _Atomic uint32_t RTD_RingIndex_t;
+#else
+typedef volatile uint32_t RTD_RingIndex_t;
+#endif
+
+/** @brief Streaming sample record. */
+typedef struct
+{
+    uint64_t timestamp;    /**< Acquisition timestamp (caller-defined units)                 */
+    uint32_t channel;      /**< Channel number                                               */
+    uint32_t status;       /**< Status flags (@c RTD_SAMPLE_x)                                */
+    double value;          /**< Resistance in ohms on input, temperature in °C on output     */
+} RTD_Sample_t;
+
+/**
+ * @brief Bounded lock-free SPSC ring of samples.
+ *
+ * @details
+ * Indices run freely and are masked with (capacity - 1); the producer only writes @c head and
+ * the consumer only writes @c tail, each on its own cache line. Initialize with @c RTD_Ring_Init.
+ */
+typedef struct
+{
+    RTD_Sample_t *buffer;                                              /**< Caller-provided storage      */
+    uint32_t capacity;                                                 /**< Number of slots (power of 2) */
+    uint8_t reserved0[RTD_CACHE_LINE_SIZE - sizeof(void *) - sizeof(uint32_t)];
+    RTD_RingIndex_t head;                                              /**< Next slot to write           */
+    uint8_t reserved1[RTD_CACHE_LINE_SIZE - sizeof(uint32_t)];
+    RTD_RingIndex_t tail;                                              /**< Next slot to read            */
+    uint8_t reserved2[RTD_CACHE_LINE_SIZE - sizeof(uint32_t)];
+} RTD_Ring_t;
+
+/**
+ * @brief Latest-value slot of one channel (exactly one cache line).
+ *
+ * @details
+ * @c sequence is odd while the writer updates the slot and even otherwise; a reader accepts a
+ * snapshot only if it saw the same even value before and after copying the data.
+ */
+typedef struct
+{
+    RTD_RingIndex_t sequence;    /**< Seqlock sequence counter                 */
+    uint32_t status;             /**< Status flags of the stored sample         */
+    uint64_t timestamp;          /**< Timestamp of the stored sample            */
+    double temperature;          /**< Stored temperature in degrees Celsius     */
+    uint8_t reserved[RTD_CACHE_LINE_SIZE - (2U * sizeof(uint32_t)) - sizeof(uint64_t) - sizeof(double)];
+} RTD_LatestSlot_t;
+
+/** @brief Latest-value table of all channels (single writer, any number of readers). */
+typedef struct
+{
+    RTD_LatestSlot_t *slots;     /**< One slot per channel (cache-line aligned storage) */
+    uint32_t channel_count;      /**< Number of channels                               */
+} RTD_LatestTable_t;
+
+/**
+ * @brief Conversion cache of a pipeline stage (all storage caller-provided).
+ *
+ * @details
+ * Two optional layers are checked before a sample is converted:
+ * - a per-channel last-input/last-output pair, hit when a channel repeats its previous
+ *   resistance exactly (e.g. the same ADC code on a stable process);
+ * - a direct-mapped table keyed on the exact resistance and the descriptor index, shared by all
+ *   channels of the same sensor descriptor, hit when quantized inputs recur across channels.
+ *
+ * Either layer is disabled by passing @c NULL storage and a zero size to @c RTD_Cache_Init.
+ */
+typedef struct
+{
+    double *last_resistance;     /**< Last resistance of each channel                   */
+    double *last_temperature;    /**< Temperature of @c last_resistance                 */
+    uint32_t channel_count;      /**< Number of per-channel entries                     */
+    double *entry_resistance;    /**< Direct-mapped entry keys (resistance)             */
+    double *entry_temperature;   /**< Direct-mapped entry values (temperature)          */
+    uint8_t *entry_descriptor;   /**< Descriptor index of each entry (or invalid)       */
+    uint32_t entry_count;        /**< Number of direct-mapped entries (power of 2)      */
+    uint64_t channel_hits;       /**< Samples served by the per-channel layer           */
+    uint64_t entry_hits;         /**< Samples served by the direct-mapped layer         */
+    uint64_t misses;             /**< Samples converted by the batch kernel             */
+} RTD_ConversionCache_t;
+
+/** @brief Streaming conversion stage between an input and an output ring. */
+typedef struct
+{
+    RTD_Ring_t *input;                            /**< Raw samples (resistances) from one producer  */
+    RTD_Ring_t *output;                           /**< Converted samples (temperatures) to consumer */
+    const RTD_DescriptorTable_t *descriptors;     /**< Sensor descriptors                            */
+    const uint8_t *channel_descriptors;           /**< Descriptor index of each channel              */
+    uint32_t channel_count;                       /**< Number of channels                            */
+    RTD_LatestTable_t *latest;                    /**< Optional latest-value table (may be @c NULL)  */
+    RTD_ConversionCache_t *cache;                 /**< Optional conversion cache (may be @c NULL)    */
+    RTD_ChangeDetector_t *change;                 /**< Optional change detector (may be @c NULL)     */
+    RTD_Rollup_t *rollup;                         /**< Optional rollup stage (may be @c NULL)        */
+    uint64_t samples_processed;                   /**< Samples published to the output ring          */
+    uint64_t samples_failed;                      /**< Samples published with a failure status       */
+} RTD_Pipeline_t;
+
+
+/* ------------------------------------ Prototype ------------------------------------- */
+
+/**
+ * @brief Initializes an empty sample ring.
+ *
+ * @param[out] ring      Ring to initialize.
+ * @param[in]  buffer    Storage for @p capacity samples.
+ * @param[in]  capacity  Number of slots. Must be a power of two.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Ring_Init(RTD_Ring_t *ring, RTD_Sample_t *buffer, uint32_t capacity);
+
+/**
+ * @brief Returns the number of samples waiting in a ring.
+ *
+ * @param[in] ring  Sample ring.
+ *
+ * @return Number of samples that can be popped.
+ */
+uint32_t RTD_Ring_GetCount(const RTD_Ring_t *ring);
+
+/**
+ * @brief Returns the number of free slots in a ring.
+ *
+ * @param[in] ring  Sample ring.
+ *
+ * @return Number of samples that can be pushed.
+ */
+uint32_t RTD_Ring_GetSpace(const RTD_Ring_t *ring);
+
+/**
+ * @brief Pushes samples into a ring (producer side).
+ *
+ * @param[in,out] ring     Sample ring.
+ * @param[in]     samples  Samples to push.
+ * @param[in]     count    Number of samples.
+ *
+ * @return Number of samples pushed; fewer than @p count if the ring is full (backpressure).
+ */
+uint32_t RTD_Ring_Push(RTD_Ring_t *ring, const RTD_Sample_t *samples, uint32_t count);
+
+/**
+ * @brief Pops samples from a ring (consumer side).
+ *
+ * @param[in,out] ring         Sample ring.
+ * @param[out]    samples      Destination for the popped samples.
+ * @param[in]     max_samples  Maximum number of samples to pop.
+ *
+ * @return Number of samples popped.
+ */
+uint32_t RTD_Ring_Pop(RTD_Ring_t *ring, RTD_Sample_t *samples, uint32_t max_samples);
+
+/**
+ * @brief Initializes a streaming conversion stage.
+ *
+ * @param[out] pipeline             Pipeline to initialize.
+ * @param[in]  input                Ring of raw samples; the pipeline is its only consumer.
+ * @param[in]  output               Ring of converted samples; the pipeline is its only producer.
+ * @param[in]  descriptors          Sensor descriptor table.
+ * @param[in]  channel_descriptors  Descriptor index of each channel.
+ * @param[in]  channel_count        Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Pipeline_Init(RTD_Pipeline_t *pipeline, RTD_Ring_t *input, RTD_Ring_t *output,
+                          const RTD_DescriptorTable_t *descriptors, const uint8_t *channel_descriptors, uint32_t channel_count);
+
+/**
+ * @brief Drains the input ring through the batch kernel into the output ring.
+ *
+ * @details
+ * Converts at most @p max_samples samples in batches of @c RTD_STREAM_BATCH_SIZE, never more
+ * than the output ring can accept, so each call has a bounded cost. Samples of unknown channels
+ * or with out-of-range resistances are published with @c RTD_SAMPLE_CONVERSION_FAILED and a
+ * value of @c RTD_CONVERSION_FAILED; timestamps and channel numbers are passed through.
+ * If a conversion cache is attached, repeated resistances are served from it without conversion.
+ * If a latest-value table is attached, it is updated with every published sample.
+ * If a change detector is attached, change points are marked with @c RTD_SAMPLE_CHANGE_UP or
+ * @c RTD_SAMPLE_CHANGE_DOWN. If a rollup stage is attached, every sample is added to it.
+ *
+ * @param[in,out] pipeline     Pipeline stage.
+ * @param[in]     max_samples  Maximum number of samples to process in this call.
+ *
+ * @return Number of samples published to the output ring.
+ */
+uint32_t RTD_Pipeline_Process(RTD_Pipeline_t *pipeline, uint32_t max_samples);
+
+/**
+ * @brief Attaches a latest-value table that the pipeline updates after each conversion.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     latest    Latest-value table, or @c NULL to detach. The pipeline becomes its only writer.
+ */
+void RTD_Pipeline_AttachLatest(RTD_Pipeline_t *pipeline, RTD_LatestTable_t *latest);
+
+/**
+ * @brief Initializes an empty conversion cache.
+ *
+ * @param[out] cache              Cache to initialize.
+ * @param[in]  last_resistance    Storage for @p channel_count last resistances, or @c NULL.
+ * @param[in]  last_temperature   Storage for @p channel_count last temperatures, or @c NULL.
+ * @param[in]  channel_count      Number of channels of the per-channel layer (0 disables it).
+ * @param[in]  entry_resistance   Storage for @p entry_count entry keys, or @c NULL.
+ * @param[in]  entry_temperature  Storage for @p entry_count entry values, or @c NULL.
+ * @param[in]  entry_descriptor   Storage for @p entry_count entry descriptor indices, or @c NULL.
+ * @param[in]  entry_count        Number of direct-mapped entries, a power of two (0 disables the layer).
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Cache_Init(RTD_ConversionCache_t *cache, double *last_resistance, double *last_temperature, uint32_t channel_count,
+                       double *entry_resistance, double *entry_temperature, uint8_t *entry_descriptor, uint32_t entry_count);
+
+/**
+ * @brief Returns the fraction of samples served from a conversion cache.
+ *
+ * @param[in] cache  Conversion cache.
+ *
+ * @return Hit rate in the range 0 to 1 (0 if no sample was looked up yet).
+ */
+double RTD_Cache_GetHitRate(const RTD_ConversionCache_t *cache);
+
+/**
+ * @brief Attaches a conversion cache that the pipeline consults before converting.
+ *
+ * @details
+ * The cache must have been initialized for the descriptor table of this pipeline and must not
+ * be shared with another pipeline.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     cache     Conversion cache, or @c NULL to detach.
+ */
+void RTD_Pipeline_AttachCache(RTD_Pipeline_t *pipeline, RTD_ConversionCache_t *cache);
+
+/**
+ * @brief Attaches a change detector that the pipeline updates with every converted sample.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     detector  Change detector indexed by channel number, or @c NULL to detach. The
+ *                          pipeline becomes its only writer.
+ */
+void RTD_Pipeline_AttachChangeDetector(RTD_Pipeline_t *pipeline, RTD_ChangeDetector_t *detector);
+
+/**
+ * @brief Attaches a rollup stage that the pipeline feeds with every converted sample.
+ *
+ * @details
+ * Closed windows accumulate in the records of the rollup stage. Read and clear them between
+ * calls to @c RTD_Pipeline_Process on the thread that runs the pipeline.
+ *
+ * @param[in,out] pipeline  Pipeline stage.
+ * @param[in]     rollup    Rollup stage indexed by channel number, or @c NULL to detach.
+ */
+void RTD_Pipeline_AttachRollup(RTD_Pipeline_t *pipeline, RTD_Rollup_t *rollup);
+
+/**
+ * @brief Initializes a latest-value table with every channel marked @c RTD_SAMPLE_NO_DATA.
+ *
+ * @param[out] table          Table to initialize.
+ * @param[in]  slots          Storage for @p channel_count slots, aligned to @c RTD_CACHE_LINE_SIZE.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 if an argument is invalid.
+ */
+uint8_t RTD_Latest_Init(RTD_LatestTable_t *table, RTD_LatestSlot_t *slots, uint32_t channel_count);
+
+/**
+ * @brief Stores samples in a latest-value table (single writer).
+ *
+ * @param[in,out] table    Latest-value table.
+ * @param[in]     samples  Converted samples; samples of unknown channels are ignored.
+ * @param[in]     count    Number of samples.
+ */
+void RTD_Latest_Update(RTD_LatestTable_t *table, const RTD_Sample_t *samples, uint32_t count);
+
+/**
+ * @brief Reads the latest sample of a channel (wait-free).
+ *
+ * @details
+ * Makes a single attempt and never waits for the writer. If the slot was being updated during
+ * the copy the function returns 0 and the caller may simply try again.
+ *
+ * @param[in]  table    Latest-value table.
+ * @param[in]  channel  Channel number.
+ * @param[out] sample   Consistent snapshot of the slot (value is the temperature).
+ *
+ * @return 1 if @p sample holds a consistent snapshot, 0 otherwise.
+ */
+uint8_t RTD_Latest_Read(const RTD_LatestTable_t *table, uint32_t channel, RTD_Sample_t *sample);
+
+#if defined(RTD_LATEST_POSIX_SHM)
+
+/**
+ * @brief Creates (or replaces) a latest-value table in POSIX shared memory for writing.
+ *
+ * @param[out] table          Table to initialize.
+ * @param[in]  name           Shared-memory object name (e.g. "/rtd_latest").
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+uint8_t RTD_Latest_CreateShared(RTD_LatestTable_t *table, const char *name, uint32_t channel_count);
+
+/**
+ * @brief Maps an existing shared latest-value table read-only.
+ *
+ * @param[out] table          Table to initialize for reading with @c RTD_Latest_Read only.
+ * @param[in]  name           Shared-memory object name.
+ * @param[in]  channel_count  Number of channels.
+ *
+ * @return 1 on success, 0 on failure (also if the object is smaller than @p channel_count slots).
+ */
+uint8_t RTD_Latest_OpenShared(RTD_LatestTable_t *table, const char *name, uint32_t channel_count);
+
+/**
+ * @brief Unmaps a shared latest-value table.
+ *
+ * @param[in,out] table  Table created by @c RTD_Latest_CreateShared or @c RTD_Latest_OpenShared.
+ */
+void RTD_Latest_CloseShared(RTD_LatestTable_t *table);
+
+#endif  /* RTD_LATEST_POSIX_SHM */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif  /* platinum_rtd_stream.h */
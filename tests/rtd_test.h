@@ -0,0 +1,62 @@
+/**
+ * @file    rtd_test.h
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Minimal check macros shared by the test programs.
+ *
+ * @details
+ * Each test program counts failed checks and returns non-zero from @c main if any failed, so
+ * the @c check target of the Makefile fails with it.
+ */
+
+
+#ifndef _RTD_TEST_H
+#define _RTD_TEST_H
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <stdio.h>    ///< printf
+#include <math.h>     ///< fabs
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+/** @brief Number of failed checks of the test program (defined by @c RTD_TEST_MAIN) */
+extern unsigned rtd_test_failures;
+
+/** @brief Defines the failure counter; use once per test program */
+#define  RTD_TEST_MAIN  unsigned rtd_test_failures = 0U
+
+/** @brief Checks a condition */
+#define  RTD_CHECK(condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(condition))                                                            \
+        {                                                                            \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);     \
+            rtd_test_failures++;                                                     \
+        }                                                                            \
+    } while (0)
+
+/** @brief Checks that two doubles differ by at most @p tolerance */
+#define  RTD_CHECK_NEAR(actual, expected, tolerance)                                                     \
+    do                                                                                                   \
+    {                                                                                                    \
+        double rtd_actual = (actual), rtd_expected = (expected);                                         \
+        if (!(fabs(rtd_actual - rtd_expected) <= (tolerance)))                                           \
+        {                                                                                                \
+            printf("%s:%d: %s = %.17g, expected %.17g\n", __FILE__, __LINE__, #actual, rtd_actual,       \
+                   rtd_expected);                                                                        \
+            rtd_test_failures++;                                                                         \
+        }                                                                                                \
+    } while (0)
+
+/** @brief Reports the result of the test program; use as the return value of @c main */
+#define  RTD_TEST_RESULT()  ((rtd_test_failures == 0U) ? (printf("%s: ok\n", __FILE__), 0) : (printf("%s: %u failed\n", __FILE__, rtd_test_failures), 1))
+
+
+#endif  /* rtd_test.h */
@@ -0,0 +1,97 @@
+/**
+ * @file    test_alarm.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the resistance-domain alarm limits and their hysteresis.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_alarm.h"       ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_CHANNEL_COUNT  34U       /**< Channels of the table (two mask words)  */
+#define  TEST_HIGH_CHANNEL   0U        /**< Channel with a high limit               */
+#define  TEST_LOW_CHANNEL    33U       /**< Channel with a low limit                */
+#define  TEST_STEP_COUNT     5U        /**< Frames of the hysteresis sequence       */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Set and clear of a high and a low alarm with hysteresis.
+ */
+static void TestHysteresis(void)
+{
+    uint32_t step = 0U, channel = 0U;
+    double high_set[TEST_CHANNEL_COUNT];
+    double high_clear[TEST_CHANNEL_COUNT];
+    double low_set[TEST_CHANNEL_COUNT];
+    double low_clear[TEST_CHANNEL_COUNT];
+    uint8_t state[TEST_CHANNEL_COUNT];
+    double resistances[TEST_CHANNEL_COUNT];
+    uint32_t mask[2];
+    RTD_AlarmTable_t table;
+
+    /* High limit 100°C clearing at 95°C; low limit 0°C clearing at 2°C */
+    const double high_temperatures[TEST_STEP_COUNT] = {99.0, 101.0, 96.0, 94.0, 99.0};
+    const double low_temperatures[TEST_STEP_COUNT] = {1.0, -1.0, 1.5, 2.5, 1.0};
+    const uint8_t high_states[TEST_STEP_COUNT] = {RTD_ALARM_NONE, RTD_ALARM_HIGH, RTD_ALARM_HIGH, RTD_ALARM_NONE, RTD_ALARM_NONE};
+    const uint8_t low_states[TEST_STEP_COUNT] = {RTD_ALARM_NONE, RTD_ALARM_LOW, RTD_ALARM_LOW, RTD_ALARM_NONE, RTD_ALARM_NONE};
+
+    RTD_CHECK(RTD_Alarm_Init(&table, high_set, high_clear, low_set, NULL, state, TEST_CHANNEL_COUNT) == 0U);
+    RTD_CHECK(RTD_Alarm_Init(&table, high_set, high_clear, low_set, low_clear, state, TEST_CHANNEL_COUNT) == 1U);
+    RTD_CHECK(RTD_Alarm_SetHighLimit(&table, TEST_HIGH_CHANNEL, RTD_SENSOR_PT100, 100.0, 5.0) == 1U);
+    RTD_CHECK(RTD_Alarm_SetLowLimit(&table, TEST_LOW_CHANNEL, RTD_SENSOR_PT100, 0.0, 2.0) == 1U);
+
+    /* Invalid limits leave the table unchanged */
+    RTD_CHECK(RTD_Alarm_SetHighLimit(&table, TEST_HIGH_CHANNEL, RTD_SENSOR_PT100, 100.0, -1.0) == 0U);
+    RTD_CHECK(RTD_Alarm_SetHighLimit(&table, TEST_HIGH_CHANNEL, RTD_SENSOR_PT100, 900.0, 5.0) == 0U);
+    RTD_CHECK(RTD_Alarm_SetLowLimit(&table, TEST_CHANNEL_COUNT, RTD_SENSOR_PT100, 0.0, 2.0) == 0U);
+
+    /* Channels without limits never alarm, whatever their resistance */
+    for (channel = 0U; channel < TEST_CHANNEL_COUNT; channel++)
+    {
+        resistances[channel] = ((channel & 1U) != 0U) ? 1.0e6 : 0.0;
+    }
+
+    for (step = 0U; step < TEST_STEP_COUNT; step++)
+    {
+        resistances[TEST_HIGH_CHANNEL] = RTD_CalculateResistance(RTD_SENSOR_PT100, high_temperatures[step]);
+        resistances[TEST_LOW_CHANNEL] = RTD_CalculateResistance(RTD_SENSOR_PT100, low_temperatures[step]);
+
+        RTD_CHECK(RTD_Alarm_Evaluate(&table, resistances, mask) == ((high_states[step] != RTD_ALARM_NONE) ? 2U : 0U));
+        RTD_CHECK(state[TEST_HIGH_CHANNEL] == high_states[step]);
+        RTD_CHECK(state[TEST_LOW_CHANNEL] == low_states[step]);
+        RTD_CHECK(mask[0] == ((high_states[step] != RTD_ALARM_NONE) ? 0x1U : 0U));
+        RTD_CHECK(mask[1] == ((low_states[step] != RTD_ALARM_NONE) ? 0x2U : 0U));
+    }
+
+    /* The mask is optional */
+    resistances[TEST_HIGH_CHANNEL] = RTD_CalculateResistance(RTD_SENSOR_PT100, 101.0);
+    RTD_CHECK(RTD_Alarm_Evaluate(&table, resistances, NULL) == 1U);
+    RTD_CHECK(state[TEST_HIGH_CHANNEL] == RTD_ALARM_HIGH);
+}
+
+
+int main(void)
+{
+    TestHysteresis();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_alarm.c */
@@ -0,0 +1,204 @@
+/**
+ * @file    test_calib.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the Callendar–Van Dusen fit and custom sensor descriptors.
+ *
+ * @details
+ * Calibration points are generated from the IEC 60751 PT100 curve, so an exact fit must
+ * recover R0 = 100 ohms and the standard coefficients with residuals at rounding level.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_calib.h"       ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_POINT_COUNT     12U        /**< Points of a full-range calibration            */
+#define  TEST_SENSOR_COUNT    3U         /**< Sensors of the chunked data set               */
+#define  TEST_RMS_LIMIT       1.0e-12    /**< Accepted RMS residual of an exact fit (ohms)  */
+#define  TEST_ERROR_LIMIT     1.0e-9     /**< Accepted temperature error of an exact fit (K) */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static const double full_temperatures[TEST_POINT_COUNT] =
+{
+    -200.0, -150.0, -100.0, -50.0, -20.0, 0.0, 50.0, 100.0, 200.0, 400.0, 600.0, 850.0
+};
+
+static const double positive_temperatures[6] = {0.0, 25.0, 100.0, 250.0, 500.0, 850.0};
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Fills PT100 resistances at the given temperatures.
+ */
+static void FillResistances(const double *temperatures, double *resistances, uint32_t count)
+{
+    uint32_t index = 0U;
+
+    for (index = 0U; index < count; index++)
+    {
+        resistances[index] = RTD_CalculateResistance(RTD_SENSOR_PT100, temperatures[index]);
+    }
+}
+
+/**
+ * @brief Checks that a fit recovered the IEC 60751 PT100 curve.
+ */
+static void CheckStandard(const RTD_CalibrationResult_t *result, uint32_t point_count, uint8_t has_c)
+{
+    RTD_CHECK(result->point_count == point_count);
+    RTD_CHECK(result->has_c == has_c);
+    RTD_CHECK_NEAR(result->resistance_at_zero, 100.0, 1.0e-10);
+    RTD_CHECK_NEAR(result->coefficient_a, RTD_A_COEFFICIENT, 1.0e-14);
+    RTD_CHECK_NEAR(result->coefficient_b, RTD_B_COEFFICIENT, 1.0e-17);
+    RTD_CHECK_NEAR(result->coefficient_c, RTD_C_COEFFICIENT, 1.0e-19);
+    RTD_CHECK(result->rms_residual < TEST_RMS_LIMIT);
+    RTD_CHECK(result->max_error < TEST_ERROR_LIMIT);
+}
+
+/**
+ * @brief Full-range, positive-only and degenerate single-sensor fits.
+ */
+static void TestFit(void)
+{
+    uint32_t index = 0U;
+    double resistances[TEST_POINT_COUNT];
+    double weights[TEST_POINT_COUNT];
+    double repeated[TEST_POINT_COUNT];
+    RTD_CalibrationResult_t result;
+
+    FillResistances(full_temperatures, resistances, TEST_POINT_COUNT);
+    RTD_CHECK(RTD_Calib_Fit(full_temperatures, resistances, NULL, TEST_POINT_COUNT, &result) == 1U);
+    CheckStandard(&result, TEST_POINT_COUNT, 1U);
+
+    /* Zero-weight points do not count; here they remove every sub-zero point */
+    for (index = 0U; index < TEST_POINT_COUNT; index++)
+    {
+        weights[index] = (full_temperatures[index] < 0.0) ? 0.0 : 2.0;
+    }
+
+    RTD_CHECK(RTD_Calib_Fit(full_temperatures, resistances, weights, TEST_POINT_COUNT, &result) == 1U);
+    CheckStandard(&result, TEST_POINT_COUNT - 5U, 0U);
+
+    /* Without sub-zero points C keeps its default */
+    FillResistances(positive_temperatures, resistances, 6U);
+    RTD_CHECK(RTD_Calib_Fit(positive_temperatures, resistances, NULL, 6U, &result) == 1U);
+    CheckStandard(&result, 6U, 0U);
+    RTD_CHECK(result.coefficient_c == RTD_C_COEFFICIENT);
+
+    /* Repeated temperatures do not determine the coefficients */
+    for (index = 0U; index < TEST_POINT_COUNT; index++)
+    {
+        repeated[index] = (index < 6U) ? 20.0 : 80.0;
+    }
+
+    FillResistances(repeated, resistances, TEST_POINT_COUNT);
+    RTD_CHECK(RTD_Calib_Fit(repeated, resistances, NULL, TEST_POINT_COUNT, &result) == 0U);
+    RTD_CHECK(result.point_count == 0U);
+
+    /* Out-of-range temperatures and negative weights are invalid arguments */
+    repeated[0] = 900.0;
+    RTD_CHECK(RTD_Calib_Fit(repeated, resistances, NULL, TEST_POINT_COUNT, &result) == 0U);
+    weights[0] = -1.0;
+    RTD_CHECK(RTD_Calib_Fit(full_temperatures, resistances, weights, TEST_POINT_COUNT, &result) == 0U);
+}
+
+/**
+ * @brief Chunked fits of several sensors, one of them without points.
+ */
+static void TestFitChunk(void)
+{
+    uint32_t index = 0U;
+    double temperatures[2U * TEST_POINT_COUNT];
+    double resistances[2U * TEST_POINT_COUNT];
+    const uint32_t offsets[TEST_SENSOR_COUNT + 1U] = {0U, TEST_POINT_COUNT, TEST_POINT_COUNT, 2U * TEST_POINT_COUNT};
+    RTD_CalibrationResult_t results[TEST_SENSOR_COUNT];
+    RTD_CalibrationData_t data;
+
+    for (index = 0U; index < (2U * TEST_POINT_COUNT); index++)
+    {
+        temperatures[index] = full_temperatures[index % TEST_POINT_COUNT];
+    }
+
+    FillResistances(temperatures, resistances, 2U * TEST_POINT_COUNT);
+    data.temperatures = temperatures;
+    data.resistances = resistances;
+    data.weights = NULL;
+    data.offsets = offsets;
+    data.sensor_count = TEST_SENSOR_COUNT;
+
+    /* Chunks of two sensors: the first holds sensor 0 and the empty sensor 1 */
+    RTD_CHECK(RTD_Calib_FitChunk(&data, results, 2U, 0U) == 1U);
+    RTD_CHECK(RTD_Calib_FitChunk(&data, results, 2U, 1U) == 1U);
+    RTD_CHECK(RTD_Calib_FitChunk(&data, results, 2U, 2U) == 0U);
+
+    CheckStandard(&results[0], TEST_POINT_COUNT, 1U);
+    RTD_CHECK(results[1].point_count == 0U);
+    CheckStandard(&results[2], TEST_POINT_COUNT, 1U);
+}
+
+/**
+ * @brief Custom descriptors: validation and the round trip through the mixed conversion.
+ */
+static void TestCustomDescriptor(void)
+{
+    uint32_t index = 0U;
+    uint8_t standard = 0U, custom = 0U;
+    uint8_t descriptors[2];
+    double resistances[2];
+    double temperatures[2];
+    RTD_DescriptorTable_t table;
+
+    RTD_InitDescriptorTable(&table);
+    standard = RTD_AddDescriptor(&table, RTD_SENSOR_PT100);
+    custom = RTD_AddCustomDescriptor(&table, 100.0, RTD_A_COEFFICIENT, RTD_B_COEFFICIENT, RTD_C_COEFFICIENT);
+    RTD_CHECK( (standard == 0U) && (custom == 1U) );
+
+    /* Non-positive R0 and curves that do not increase over the range are rejected */
+    RTD_CHECK(RTD_AddCustomDescriptor(&table, 0.0, RTD_A_COEFFICIENT, RTD_B_COEFFICIENT, RTD_C_COEFFICIENT) == RTD_INVALID_DESCRIPTOR);
+    RTD_CHECK(RTD_AddCustomDescriptor(&table, 100.0, -RTD_A_COEFFICIENT, RTD_B_COEFFICIENT, RTD_C_COEFFICIENT) == RTD_INVALID_DESCRIPTOR);
+    RTD_CHECK(RTD_AddCustomDescriptor(&table, 100.0, RTD_A_COEFFICIENT, -1.0e-5, RTD_C_COEFFICIENT) == RTD_INVALID_DESCRIPTOR);
+
+    RTD_CHECK(RTD_CalculateDescriptorResistance(&table, custom, 900.0) == RTD_CONVERSION_FAILED);
+    RTD_CHECK(RTD_CalculateDescriptorResistance(&table, 5U, 20.0) == RTD_CONVERSION_FAILED);
+
+    for (index = 0U; index < TEST_POINT_COUNT; index++)
+    {
+        resistances[0] = RTD_CalculateDescriptorResistance(&table, custom, full_temperatures[index]);
+        RTD_CHECK_NEAR(resistances[0], RTD_CalculateResistance(RTD_SENSOR_PT100, full_temperatures[index]), 1.0e-12);
+
+        /* The custom copy of the PT100 curve converts like the standard type */
+        descriptors[0] = standard;
+        descriptors[1] = custom;
+        resistances[1] = resistances[0];
+        RTD_CHECK(RTD_CalculateTemperatureMixed(&table, descriptors, resistances, temperatures, 2U) == 2U);
+        RTD_CHECK_NEAR(temperatures[0], full_temperatures[index], TEST_ERROR_LIMIT);
+        RTD_CHECK_NEAR(temperatures[1], temperatures[0], TEST_ERROR_LIMIT);
+    }
+}
+
+
+int main(void)
+{
+    TestFit();
+    TestFitChunk();
+    TestCustomDescriptor();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_calib.c */
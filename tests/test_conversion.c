@@ -0,0 +1,273 @@
+/**
+ * @file    test_conversion.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the array conversions against the double-double reference.
+ *
+ * @details
+ * Resistances of every sensor type are generated over -200°C to +850°C. The batch, mixed,
+ * chunked and strided conversions must agree with @c RTD_CalculateTemperaturePrecise of the
+ * same (rounded) resistance, and chunked and strided results must be bit-identical to the
+ * batch results. A masked strided conversion must leave unselected outputs untouched.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_sensor.h"      ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_STEP_COUNT  21001U      /**< -200°C to +850°C in 0.05 K steps   */
+#define  TEST_TYPE_COUNT  5U          /**< Standard sensor types              */
+#define  TEST_TOLERANCE   1.0e-9      /**< Accepted error of the batch kernel (°C) */
+#define  TEST_UNTOUCHED   12345.0     /**< Marks outputs that must not be written  */
+
+
+/* -------------------------------------- Types --------------------------------------- */
+
+/** @brief Acquisition frame used to test strided access */
+typedef struct
+{
+    double resistance;
+    uint32_t status;
+    double temperature;
+} TestFrame_t;
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static const uint16_t sensor_types[TEST_TYPE_COUNT] =
+{
+    RTD_SENSOR_PT50, RTD_SENSOR_PT100, RTD_SENSOR_PT200, RTD_SENSOR_PT500, RTD_SENSOR_PT1000
+};
+
+static double resistances[TEST_STEP_COUNT];
+static double references[TEST_STEP_COUNT];
+static double batch[TEST_STEP_COUNT];
+static double output[TEST_STEP_COUNT];
+static TestFrame_t frames[TEST_STEP_COUNT];
+static double mixed_resistances[TEST_STEP_COUNT * TEST_TYPE_COUNT];
+static double mixed_references[TEST_STEP_COUNT * TEST_TYPE_COUNT];
+static double mixed_output[TEST_STEP_COUNT * TEST_TYPE_COUNT];
+static uint8_t mixed_indices[TEST_STEP_COUNT * TEST_TYPE_COUNT];
+static uint32_t mask[(TEST_STEP_COUNT + 31U) / 32U];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Fills the resistances of one sensor type and their reference temperatures.
+ */
+static void FillReference(uint16_t sensor_type)
+{
+    uint32_t index = 0U;
+    RTD_Precise_t temperature = {0.0, 0.0}, resistance = {0.0, 0.0};
+
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        temperature.hi = -200.0 + (0.05 * (double)index);
+        resistance = RTD_CalculateResistancePrecise(sensor_type, temperature);
+        resistances[index] = resistance.hi;
+
+        /* The reference is the exact temperature of the rounded input */
+        resistance.lo = 0.0;
+        temperature = RTD_CalculateTemperaturePrecise(sensor_type, resistance);
+        references[index] = temperature.hi + temperature.lo;
+    }
+}
+
+/**
+ * @brief Batch, chunked and strided conversion of one sensor type.
+ */
+static void TestSingleType(uint16_t sensor_type)
+{
+    uint32_t index = 0U, chunk = 0U, converted = 0U;
+    const uint32_t chunk_size = 1000U;
+
+    FillReference(sensor_type);
+
+    converted = RTD_CalculateTemperatureBatch(sensor_type, resistances, batch, TEST_STEP_COUNT);
+    RTD_CHECK(converted == TEST_STEP_COUNT);
+
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        RTD_CHECK_NEAR(batch[index], references[index], TEST_TOLERANCE);
+    }
+
+    /* Chunked conversion is bit-identical to one batch call */
+    converted = 0U;
+
+    for (chunk = 0U; chunk < RTD_GetChunkCount(TEST_STEP_COUNT, chunk_size); chunk++)
+    {
+        converted += RTD_CalculateTemperatureChunk(sensor_type, resistances, output, TEST_STEP_COUNT, chunk_size, chunk);
+    }
+
+    RTD_CHECK(converted == TEST_STEP_COUNT);
+
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        RTD_CHECK(output[index] == batch[index]);
+    }
+
+    /* Strided conversion inside an array of frames */
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        frames[index].resistance = resistances[index];
+        frames[index].status = index;
+        frames[index].temperature = 0.0;
+    }
+
+    converted = RTD_CalculateTemperatureStrided(sensor_type, &frames[0].resistance, (uint32_t)sizeof(TestFrame_t),
+                                                &frames[0].temperature, (uint32_t)sizeof(TestFrame_t), TEST_STEP_COUNT, NULL);
+    RTD_CHECK(converted == TEST_STEP_COUNT);
+
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        RTD_CHECK(frames[index].temperature == batch[index]);
+        RTD_CHECK(frames[index].status == index);
+    }
+}
+
+/**
+ * @brief Masked strided conversion touches only the selected elements.
+ */
+static void TestMaskedStrided(void)
+{
+    uint32_t index = 0U, selected = 0U, converted = 0U, is_selected = 0U;
+
+    FillReference(RTD_SENSOR_PT100);
+    (void)RTD_CalculateTemperatureBatch(RTD_SENSOR_PT100, resistances, batch, TEST_STEP_COUNT);
+
+    /* Every third element, with runs of empty mask words in between; one selected input fails */
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        if ((index & 31U) == 0U)
+        {
+            mask[index >> 5U] = 0U;
+        }
+
+        is_selected = (((index % 3U) == 0U) && (((index >> 5U) % 8U) < 5U)) ? 1U : 0U;
+        mask[index >> 5U] |= is_selected << (index & 31U);
+        selected += is_selected;
+        frames[index].resistance = (index == 3U) ? 1.0e4 : resistances[index];
+        frames[index].temperature = TEST_UNTOUCHED;
+    }
+
+    converted = RTD_CalculateTemperatureStrided(RTD_SENSOR_PT100, &frames[0].resistance, (uint32_t)sizeof(TestFrame_t),
+                                                &frames[0].temperature, (uint32_t)sizeof(TestFrame_t), TEST_STEP_COUNT, mask);
+    RTD_CHECK(converted == (selected - 1U));
+    RTD_CHECK(frames[3].temperature == RTD_CONVERSION_FAILED);
+
+    for (index = 4U; index < TEST_STEP_COUNT; index++)
+    {
+        if ((mask[index >> 5U] & (1U << (index & 31U))) != 0U)
+        {
+            RTD_CHECK(frames[index].temperature == batch[index]);
+        }
+        else
+        {
+            RTD_CHECK(frames[index].temperature == TEST_UNTOUCHED);
+        }
+    }
+
+    /* In place, with an element count that ends inside a skipped mask word */
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        output[index] = resistances[index];
+    }
+
+    converted = RTD_CalculateTemperatureStrided(RTD_SENSOR_PT100, output, (uint32_t)sizeof(double), output, (uint32_t)sizeof(double),
+                                                (5U * 32U) + 40U, mask);
+    RTD_CHECK(converted == 54U);
+
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        is_selected = ( (index < ((5U * 32U) + 40U)) && ((mask[index >> 5U] & (1U << (index & 31U))) != 0U) ) ? 1U : 0U;
+        RTD_CHECK(output[index] == ((is_selected != 0U) ? batch[index] : resistances[index]));
+    }
+}
+
+/**
+ * @brief Mixed conversion of all sensor types interleaved in one frame.
+ */
+static void TestMixed(void)
+{
+    uint32_t type = 0U, index = 0U, element = 0U, converted = 0U;
+    uint8_t descriptors[TEST_TYPE_COUNT];
+    RTD_DescriptorTable_t table;
+
+    RTD_InitDescriptorTable(&table);
+
+    for (type = 0U; type < TEST_TYPE_COUNT; type++)
+    {
+        descriptors[type] = RTD_AddDescriptor(&table, sensor_types[type]);
+        RTD_CHECK(descriptors[type] != RTD_INVALID_DESCRIPTOR);
+        FillReference(sensor_types[type]);
+
+        for (index = 0U; index < TEST_STEP_COUNT; index++)
+        {
+            element = (index * TEST_TYPE_COUNT) + type;
+            mixed_resistances[element] = resistances[index];
+            mixed_references[element] = references[index];
+            mixed_indices[element] = descriptors[type];
+        }
+    }
+
+    converted = RTD_CalculateTemperatureMixed(&table, mixed_indices, mixed_resistances, mixed_output, TEST_STEP_COUNT * TEST_TYPE_COUNT);
+    RTD_CHECK(converted == (TEST_STEP_COUNT * TEST_TYPE_COUNT));
+
+    for (element = 0U; element < (TEST_STEP_COUNT * TEST_TYPE_COUNT); element++)
+    {
+        RTD_CHECK_NEAR(mixed_output[element], mixed_references[element], TEST_TOLERANCE);
+    }
+
+    /* Unused descriptors and out-of-range resistances fail */
+    mixed_indices[0] = (uint8_t)table.count;
+    mixed_resistances[1] = 1.0e4;
+    converted = RTD_CalculateTemperatureMixed(&table, mixed_indices, mixed_resistances, mixed_output, 2U);
+    RTD_CHECK(converted == 0U);
+    RTD_CHECK(mixed_output[0] == RTD_CONVERSION_FAILED);
+    RTD_CHECK(mixed_output[1] == RTD_CONVERSION_FAILED);
+}
+
+/**
+ * @brief Out-of-range inputs of the batch conversion.
+ */
+static void TestOutOfRange(void)
+{
+    double inputs[3] = {1.0, 100.0, 1.0e4};
+    double results[3] = {0.0, 0.0, 0.0};
+
+    RTD_CHECK(RTD_CalculateTemperatureBatch(RTD_SENSOR_PT100, inputs, results, 3U) == 1U);
+    RTD_CHECK(results[0] == RTD_CONVERSION_FAILED);
+    RTD_CHECK_NEAR(results[1], 0.0, TEST_TOLERANCE);
+    RTD_CHECK(results[2] == RTD_CONVERSION_FAILED);
+}
+
+
+int main(void)
+{
+    uint32_t type = 0U;
+
+    for (type = 0U; type < TEST_TYPE_COUNT; type++)
+    {
+        TestSingleType(sensor_types[type]);
+    }
+
+    TestMaskedStrided();
+    TestMixed();
+    TestOutOfRange();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_conversion.c */
@@ -0,0 +1,114 @@
+/**
+ * @file    test_deadband.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the reporting rules of the resistance-domain deadband.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_deadband.h"    ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_CHANNEL_COUNT  2U       /**< Channels of the filter                  */
+#define  TEST_DEADBAND       0.5      /**< Temperature deadband (kelvin)           */
+#define  TEST_MAX_AGE        3U       /**< Discarded samples before a forced report */
+#define  TEST_UNTOUCHED      12345.0  /**< Marks outputs that must not be written  */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static double anchor_resistance[TEST_CHANNEL_COUNT];
+static double band[TEST_CHANNEL_COUNT];
+static uint32_t age[TEST_CHANNEL_COUNT];
+static uint16_t sensor_types[TEST_CHANNEL_COUNT];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Processes one frame given in degrees Celsius and returns the number of reports.
+ */
+static uint32_t ProcessFrame(RTD_Deadband_t *filter, double first, double second, double *temperatures, uint32_t *report_mask)
+{
+    double resistances[TEST_CHANNEL_COUNT];
+
+    resistances[0] = RTD_CalculateResistance(RTD_SENSOR_PT100, first);
+    resistances[1] = RTD_CalculateResistance(RTD_SENSOR_PT100, second);
+    temperatures[0] = TEST_UNTOUCHED;
+    temperatures[1] = TEST_UNTOUCHED;
+
+    return RTD_Deadband_Process(filter, resistances, temperatures, report_mask);
+}
+
+
+int main(void)
+{
+    uint32_t frame = 0U, reported = 0U, report_mask = 0U;
+    double temperatures[TEST_CHANNEL_COUNT];
+    double resistances[TEST_CHANNEL_COUNT];
+    RTD_Deadband_t filter;
+
+    RTD_CHECK(RTD_Deadband_Init(&filter, anchor_resistance, band, age, sensor_types, TEST_CHANNEL_COUNT, 0.0, TEST_MAX_AGE) == 0U);
+    RTD_CHECK(RTD_Deadband_Init(&filter, anchor_resistance, band, age, sensor_types, TEST_CHANNEL_COUNT, TEST_DEADBAND, TEST_MAX_AGE) == 1U);
+
+    /* The first sample of every channel is reported */
+    RTD_CHECK(ProcessFrame(&filter, 20.0, -150.0, temperatures, &report_mask) == 2U);
+    RTD_CHECK(report_mask == 0x3U);
+    RTD_CHECK_NEAR(temperatures[0], 20.0, 1.0e-9);
+    RTD_CHECK_NEAR(temperatures[1], -150.0, 1.0e-9);
+
+    /* Inside the band nothing is converted; outside it the sample is reported */
+    RTD_CHECK(ProcessFrame(&filter, 20.4, -150.6, temperatures, &report_mask) == 1U);
+    RTD_CHECK(report_mask == 0x2U);
+    RTD_CHECK(temperatures[0] == TEST_UNTOUCHED);
+    RTD_CHECK_NEAR(temperatures[1], -150.6, 1.0e-9);
+
+    /* The band is measured from the last reported sample, also below 0°C */
+    RTD_CHECK(ProcessFrame(&filter, 19.6, -151.0, temperatures, &report_mask) == 0U);
+    RTD_CHECK(report_mask == 0U);
+
+    /* A report is forced after max_age discarded samples: channel 0 has discarded two and
+       channel 1 one sample so far */
+    for (frame = 0U; frame < TEST_MAX_AGE; frame++)
+    {
+        reported = ProcessFrame(&filter, 20.0, -150.6, temperatures, &report_mask);
+        RTD_CHECK(reported == ((frame != 0U) ? 1U : 0U));
+        RTD_CHECK(report_mask == ((frame == 1U) ? 0x1U : ((frame == 2U) ? 0x2U : 0U)));
+    }
+
+    RTD_CHECK_NEAR(temperatures[1], -150.6, 1.0e-9);
+
+    /* A failed sample is reported but keeps the anchor */
+    resistances[0] = 1.0e4;
+    resistances[1] = RTD_CalculateResistance(RTD_SENSOR_PT100, -150.6);
+    RTD_CHECK(RTD_Deadband_Process(&filter, resistances, temperatures, &report_mask) == 1U);
+    RTD_CHECK(report_mask == 0x1U);
+    RTD_CHECK(temperatures[0] == RTD_CONVERSION_FAILED);
+    RTD_CHECK(ProcessFrame(&filter, 20.2, -150.6, temperatures, &report_mask) == 0U);
+
+    /* Setting the sensor type clears the anchor */
+    RTD_CHECK(RTD_Deadband_SetChannel(&filter, 0U, RTD_SENSOR_PT100) == 1U);
+    RTD_CHECK(RTD_Deadband_SetChannel(&filter, 1U, RTD_SENSOR_PT1000) == 1U);
+    RTD_CHECK(RTD_Deadband_SetChannel(&filter, TEST_CHANNEL_COUNT, RTD_SENSOR_PT100) == 0U);
+    resistances[0] = RTD_CalculateResistance(RTD_SENSOR_PT100, 20.0);
+    resistances[1] = RTD_CalculateResistance(RTD_SENSOR_PT1000, 300.0);
+    RTD_CHECK(RTD_Deadband_Process(&filter, resistances, temperatures, &report_mask) == 2U);
+    RTD_CHECK(report_mask == 0x3U);
+    RTD_CHECK_NEAR(temperatures[0], 20.0, 1.0e-9);
+    RTD_CHECK_NEAR(temperatures[1], 300.0, 1.0e-9);
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_deadband.c */
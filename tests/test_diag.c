@@ -0,0 +1,343 @@
+/**
+ * @file    test_diag.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks redundant-sensor voting, the sensor fault monitor and the change detector.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_diag.h"        ///< Functions under test
+#include "platinum_rtd_stream.h"      ///< Pipeline hook of the change detector
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_CHANNEL_COUNT  3U       /**< Channels of the monitor             */
+#define  TEST_STUCK_SAMPLES  4U       /**< Run length reported as stuck        */
+#define  TEST_EVENT_COUNT    8U       /**< Capacity of the event buffer        */
+#define  TEST_SET_COUNT      40U      /**< Redundancy sets, across a mask word */
+#define  TEST_TOLERANCE      1.0e-9   /**< Accepted error (°C)                 */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static uint32_t members[RTD_VOTE_MAX_MEMBERS * TEST_SET_COUNT];
+static double frame_resistances[RTD_VOTE_MAX_MEMBERS * TEST_SET_COUNT];
+static double voted[TEST_SET_COUNT];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Temperature of one resistance with the batch kernel.
+ */
+static double Temperature(double resistance)
+{
+    double temperature = 0.0;
+
+    (void)RTD_CalculateTemperatureBatch(RTD_SENSOR_PT100, &resistance, &temperature, 1U);
+
+    return temperature;
+}
+
+/**
+ * @brief Sets the three member resistances of one set (member k of set s is channel k * 40 + s).
+ */
+static void SetMembers(uint32_t set, double first, double second, double third)
+{
+    frame_resistances[set] = first;
+    frame_resistances[TEST_SET_COUNT + set] = second;
+    frame_resistances[(2U * TEST_SET_COUNT) + set] = third;
+}
+
+/**
+ * @brief Median, mean, high and low voting of 2oo3 and 1oo2 sets with invalid members.
+ */
+static void TestVoter(void)
+{
+    uint32_t index = 0U;
+    uint32_t discrepancy_mask[2] = {0xFFFFFFFFU, 0xFFFFFFFFU};
+    uint32_t degraded_mask[2] = {0xFFFFFFFFU, 0xFFFFFFFFU};
+    RTD_Voter_t voter;
+    const double r20 = RTD_CalculateResistance(RTD_SENSOR_PT100, 20.0);
+    const double r21 = RTD_CalculateResistance(RTD_SENSOR_PT100, 21.0);
+    const double r22 = RTD_CalculateResistance(RTD_SENSOR_PT100, 22.0);
+    const double r25 = RTD_CalculateResistance(RTD_SENSOR_PT100, 25.0);
+
+    for (index = 0U; index < (RTD_VOTE_MAX_MEMBERS * TEST_SET_COUNT); index++)
+    {
+        members[index] = index;
+    }
+
+    for (index = 0U; index < TEST_SET_COUNT; index++)
+    {
+        SetMembers(index, r20, r20, r20);
+    }
+
+    SetMembers(0U, r20, r25, r21);       /* Median 21°C, spread 5 K             */
+    SetMembers(1U, r20, 1.0e4, r22);     /* One member open                      */
+    SetMembers(2U, 1.0, r20, 1.0e4);     /* Two members invalid                  */
+    SetMembers(3U, 1.0, 1.0e4, 1.0);     /* No valid member                      */
+    SetMembers(31U, r20, r20, 1.0e4);    /* Degraded, last bit of word 0         */
+    SetMembers(32U, r25, r20, r25);      /* Discrepancy, first bit of word 1     */
+    SetMembers(39U, 1.0, r20, r20);      /* Degraded, in word 1                  */
+
+    RTD_CHECK(RTD_Voter_Init(&voter, RTD_SENSOR_PT100, members, TEST_SET_COUNT, 3U, (TEST_SET_COUNT * 3U) - 1U, RTD_VOTE_MEDIAN, 3.0) == 0U);
+    RTD_CHECK(RTD_Voter_Init(&voter, RTD_SENSOR_PT100, members, TEST_SET_COUNT, 3U, TEST_SET_COUNT * 3U, RTD_VOTE_MEDIAN, 3.0) == 1U);
+    RTD_CHECK(RTD_Voter_Process(&voter, frame_resistances, voted, discrepancy_mask, degraded_mask) == 2U);
+    RTD_CHECK_NEAR(voted[0], 21.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[1], Temperature(0.5 * (r20 + r22)), TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[2], 20.0, TEST_TOLERANCE);
+    RTD_CHECK(voted[3] == RTD_CONVERSION_FAILED);
+    RTD_CHECK_NEAR(voted[32], 25.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[39], 20.0, TEST_TOLERANCE);
+    RTD_CHECK( (discrepancy_mask[0] == 0x00000001U) && (discrepancy_mask[1] == 0x00000001U) );
+    RTD_CHECK( (degraded_mask[0] == 0x8000000EU) && (degraded_mask[1] == 0x00000080U) );
+
+    /* Mean, high and low leave invalid members out as well */
+    RTD_CHECK(RTD_Voter_Init(&voter, RTD_SENSOR_PT100, members, TEST_SET_COUNT, 3U, TEST_SET_COUNT * 3U, RTD_VOTE_MEAN, 3.0) == 1U);
+    (void)RTD_Voter_Process(&voter, frame_resistances, voted, NULL, NULL);
+    RTD_CHECK_NEAR(voted[0], Temperature((r20 + r25 + r21) / 3.0), TEST_TOLERANCE);
+    RTD_CHECK(voted[3] == RTD_CONVERSION_FAILED);
+
+    RTD_CHECK(RTD_Voter_Init(&voter, RTD_SENSOR_PT100, members, TEST_SET_COUNT, 3U, TEST_SET_COUNT * 3U, RTD_VOTE_HIGH, 3.0) == 1U);
+    (void)RTD_Voter_Process(&voter, frame_resistances, voted, NULL, NULL);
+    RTD_CHECK_NEAR(voted[0], 25.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[1], 22.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[2], 20.0, TEST_TOLERANCE);
+    RTD_CHECK(voted[3] == RTD_CONVERSION_FAILED);
+
+    RTD_CHECK(RTD_Voter_Init(&voter, RTD_SENSOR_PT100, members, TEST_SET_COUNT, 3U, TEST_SET_COUNT * 3U, RTD_VOTE_LOW, 3.0) == 1U);
+    (void)RTD_Voter_Process(&voter, frame_resistances, voted, NULL, NULL);
+    RTD_CHECK_NEAR(voted[0], 20.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[1], 20.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[2], 20.0, TEST_TOLERANCE);
+    RTD_CHECK(voted[3] == RTD_CONVERSION_FAILED);
+
+    /* Two members per set: the third member slot aliases the first and never votes */
+    RTD_CHECK(RTD_Voter_Init(&voter, RTD_SENSOR_PT100, members, TEST_SET_COUNT, 2U, TEST_SET_COUNT * 2U, RTD_VOTE_MEDIAN, 3.0) == 1U);
+    RTD_CHECK(RTD_Voter_Process(&voter, frame_resistances, voted, discrepancy_mask, degraded_mask) == 2U);
+    RTD_CHECK_NEAR(voted[0], Temperature(0.5 * (r20 + r25)), TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[1], 20.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(voted[2], 20.0, TEST_TOLERANCE);
+    RTD_CHECK(voted[3] == RTD_CONVERSION_FAILED);
+    RTD_CHECK_NEAR(voted[31], 20.0, TEST_TOLERANCE);
+    RTD_CHECK( (discrepancy_mask[0] == 0x00000001U) && (discrepancy_mask[1] == 0x00000001U) );
+    RTD_CHECK( (degraded_mask[0] == 0x0000000EU) && (degraded_mask[1] == 0x00000080U) );
+}
+
+/**
+ * @brief Processes one frame of three resistances.
+ */
+static uint32_t MonitorFrame(RTD_Monitor_t *monitor, double first, double second, double third, RTD_FaultEvent_t *events,
+                             uint32_t event_capacity)
+{
+    double resistances[TEST_CHANNEL_COUNT];
+
+    resistances[0] = first;
+    resistances[1] = second;
+    resistances[2] = third;
+
+    return RTD_Monitor_Process(monitor, resistances, events, event_capacity);
+}
+
+/**
+ * @brief Open, short, slew and stuck classification and the event stream.
+ */
+static void TestMonitor(void)
+{
+    uint32_t frame = 0U;
+    double previous[TEST_CHANNEL_COUNT];
+    double anchor[TEST_CHANNEL_COUNT];
+    uint32_t stuck_count[TEST_CHANNEL_COUNT];
+    uint8_t state[TEST_CHANNEL_COUNT];
+    RTD_FaultEvent_t events[TEST_EVENT_COUNT];
+    RTD_Monitor_t monitor;
+    const double r20 = RTD_CalculateResistance(RTD_SENSOR_PT100, 20.0);
+    const double r30 = RTD_CalculateResistance(RTD_SENSOR_PT100, 30.0);
+    const double r31 = RTD_CalculateResistance(RTD_SENSOR_PT100, 31.0);
+
+    RTD_CHECK(RTD_Monitor_Init(&monitor, RTD_SENSOR_PT100, previous, anchor, stuck_count, state, TEST_CHANNEL_COUNT, 5.0, 0.0, 1U) == 0U);
+    RTD_CHECK(RTD_Monitor_Init(&monitor, RTD_SENSOR_PT100, previous, anchor, stuck_count, state, TEST_CHANNEL_COUNT, 5.0, 0.0,
+                               TEST_STUCK_SAMPLES) == 1U);
+
+    /* First samples: open and short are decided alone, slew needs a predecessor */
+    RTD_CHECK(MonitorFrame(&monitor, r20, 1.0, 1.0e4, events, TEST_EVENT_COUNT) == 2U);
+    RTD_CHECK( (events[0].channel == 1U) && (events[0].faults == RTD_FAULT_SHORT) && (events[0].changed == RTD_FAULT_SHORT) );
+    RTD_CHECK( (events[1].channel == 2U) && (events[1].faults == RTD_FAULT_OPEN) && (events[1].frame == 0U) );
+
+    /* A plausible sample after a short is not a slew, however far it jumps */
+    RTD_CHECK(MonitorFrame(&monitor, r20, r30, 1.0e4, events, TEST_EVENT_COUNT) == 1U);
+    RTD_CHECK( (events[0].channel == 1U) && (events[0].faults == RTD_FAULT_NONE) && (events[0].changed == RTD_FAULT_SHORT) );
+
+    /* Channel 0 completes four identical readings in frame 3 */
+    RTD_CHECK(MonitorFrame(&monitor, r20, r31, 1.0e4, events, TEST_EVENT_COUNT) == 0U);
+    RTD_CHECK(MonitorFrame(&monitor, r20, r30, 1.0e4, events, TEST_EVENT_COUNT) == 1U);
+    RTD_CHECK( (events[0].channel == 0U) && (events[0].faults == RTD_FAULT_STUCK) && (events[0].frame == 3U) );
+
+    /* The run length saturates, so the fault persists without further events */
+    for (frame = 0U; frame < 100U; frame++)
+    {
+        RTD_CHECK(MonitorFrame(&monitor, r20, ((frame & 1U) != 0U) ? r30 : r31, 1.0e4, events, TEST_EVENT_COUNT) == 0U);
+    }
+
+    RTD_CHECK(stuck_count[0] == TEST_STUCK_SAMPLES);
+    RTD_CHECK(state[0] == RTD_FAULT_STUCK);
+
+    /* A 10 K jump clears stuck and raises slew; the next small step clears slew */
+    RTD_CHECK(MonitorFrame(&monitor, r30, r31, 1.0e4, events, TEST_EVENT_COUNT) == 1U);
+    RTD_CHECK( (events[0].faults == RTD_FAULT_SLEW) && (events[0].changed == (RTD_FAULT_SLEW | RTD_FAULT_STUCK)) );
+    RTD_CHECK(MonitorFrame(&monitor, r31, r30, 1.0e4, events, TEST_EVENT_COUNT) == 1U);
+    RTD_CHECK( (events[0].channel == 0U) && (events[0].faults == RTD_FAULT_NONE) );
+
+    /* Events beyond the capacity are counted in dropped, but only with an event buffer */
+    RTD_CHECK(MonitorFrame(&monitor, 1.0e4, 1.0, r20, events, 1U) == 1U);
+    RTD_CHECK( (events[0].channel == 0U) && (monitor.dropped == 2U) );
+    RTD_CHECK(MonitorFrame(&monitor, r20, r30, 1.0e4, NULL, 0U) == 0U);
+    RTD_CHECK(monitor.dropped == 2U);
+    RTD_CHECK( (state[0] == RTD_FAULT_NONE) && (state[1] == RTD_FAULT_NONE) && (state[2] == RTD_FAULT_OPEN) );
+}
+
+/**
+ * @brief Checks the CUSUM state of one channel.
+ */
+static void CheckChange(const RTD_ChangeDetector_t *detector, uint32_t channel, double reference, double upper, double lower)
+{
+    RTD_CHECK(detector->reference[channel] == reference);
+    RTD_CHECK_NEAR(detector->upper[channel], upper, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(detector->lower[channel], lower, TEST_TOLERANCE);
+}
+
+/**
+ * @brief Priming, failed samples, and steps up and down of the CUSUM detector.
+ */
+static void TestChangeDetector(void)
+{
+    double reference[2];
+    double upper[2];
+    double lower[2];
+    double temperatures[2];
+    uint32_t rise_mask = 0U, fall_mask = 0U;
+    uint32_t channels[2] = {1U, 2U};
+    uint8_t changes[2] = {0xFFU, 0xFFU};
+    RTD_ChangeDetector_t detector;
+
+    /* Drift 0.5 K and threshold 4 K: a 10 K step is reported on its first sample */
+    RTD_CHECK(RTD_ChangeDetector_Init(&detector, reference, upper, lower, 2U, 0.5, 0.0, 0.0) == 0U);
+    RTD_CHECK(RTD_ChangeDetector_Init(&detector, reference, upper, lower, 2U, 0.5, 4.0, 0.0) == 1U);
+
+    /* A failed sample leaves a channel unprimed; the first valid sample only primes it */
+    temperatures[0] = RTD_CONVERSION_FAILED;
+    temperatures[1] = 20.0;
+    RTD_CHECK(RTD_ChangeDetector_Process(&detector, temperatures, &rise_mask, &fall_mask) == 0U);
+    CheckChange(&detector, 0U, RTD_CONVERSION_FAILED, 0.0, 0.0);
+    CheckChange(&detector, 1U, 20.0, 0.0, 0.0);
+
+    temperatures[0] = 20.0;
+    temperatures[1] = 21.0;
+    RTD_CHECK(RTD_ChangeDetector_Process(&detector, temperatures, &rise_mask, &fall_mask) == 0U);
+    RTD_CHECK( (rise_mask == 0U) && (fall_mask == 0U) );
+    CheckChange(&detector, 0U, 20.0, 0.0, 0.0);
+    CheckChange(&detector, 1U, 20.0, 0.5, 0.0);
+
+    /* Failed samples of a primed channel leave its state unchanged */
+    temperatures[0] = RTD_CONVERSION_FAILED;
+    temperatures[1] = RTD_CONVERSION_FAILED;
+    RTD_CHECK(RTD_ChangeDetector_Process(&detector, temperatures, &rise_mask, &fall_mask) == 0U);
+    CheckChange(&detector, 0U, 20.0, 0.0, 0.0);
+    CheckChange(&detector, 1U, 20.0, 0.5, 0.0);
+
+    /* A step up sets UP once and restarts both sums at the new level */
+    temperatures[0] = 30.0;
+    temperatures[1] = 30.0;
+    RTD_CHECK(RTD_ChangeDetector_Process(&detector, temperatures, &rise_mask, &fall_mask) == 2U);
+    RTD_CHECK( (rise_mask == 0x3U) && (fall_mask == 0U) );
+    CheckChange(&detector, 0U, 30.0, 0.0, 0.0);
+    CheckChange(&detector, 1U, 30.0, 0.0, 0.0);
+
+    RTD_CHECK(RTD_ChangeDetector_Process(&detector, temperatures, &rise_mask, &fall_mask) == 0U);
+    RTD_CHECK( (rise_mask == 0U) && (fall_mask == 0U) );
+
+    /* A step down on channel 1 only */
+    temperatures[1] = 20.0;
+    RTD_CHECK(RTD_ChangeDetector_Process(&detector, temperatures, &rise_mask, &fall_mask) == 1U);
+    RTD_CHECK( (rise_mask == 0U) && (fall_mask == 0x2U) );
+    CheckChange(&detector, 1U, 20.0, 0.0, 0.0);
+    RTD_CHECK(detector.detections == 3U);
+
+    /* Samples of unknown channels are ignored by the sequence update */
+    temperatures[0] = 10.0;
+    temperatures[1] = 10.0;
+    RTD_CHECK(RTD_ChangeDetector_Update(&detector, channels, temperatures, changes, 2U) == 1U);
+    RTD_CHECK( (changes[0] == RTD_CHANGE_DOWN) && (changes[1] == RTD_CHANGE_NONE) );
+}
+
+/**
+ * @brief Change points are marked in the status of the pipeline output.
+ */
+static void TestChangePipeline(void)
+{
+    uint32_t index = 0U;
+    const double levels[6] = {20.0, 20.0, 30.0, 30.0, 20.0, 20.0};
+    const uint32_t expected[6] = {RTD_SAMPLE_OK, RTD_SAMPLE_OK, RTD_SAMPLE_CHANGE_UP, RTD_SAMPLE_OK,
+                                  RTD_SAMPLE_CHANGE_DOWN, RTD_SAMPLE_CONVERSION_FAILED};
+    uint8_t channel_descriptors[1];
+    double reference[1];
+    double upper[1];
+    double lower[1];
+    RTD_Sample_t input_buffer[8];
+    RTD_Sample_t output_buffer[8];
+    RTD_Sample_t samples[6];
+    RTD_Ring_t input;
+    RTD_Ring_t output;
+    RTD_DescriptorTable_t table;
+    RTD_ChangeDetector_t detector;
+    RTD_Pipeline_t pipeline;
+
+    RTD_InitDescriptorTable(&table);
+    channel_descriptors[0] = RTD_AddDescriptor(&table, RTD_SENSOR_PT100);
+    RTD_CHECK(RTD_Ring_Init(&input, input_buffer, 8U) == 1U);
+    RTD_CHECK(RTD_Ring_Init(&output, output_buffer, 8U) == 1U);
+    RTD_CHECK(RTD_Pipeline_Init(&pipeline, &input, &output, &table, channel_descriptors, 1U) == 1U);
+    RTD_CHECK(RTD_ChangeDetector_Init(&detector, reference, upper, lower, 1U, 0.5, 4.0, 0.0) == 1U);
+    RTD_Pipeline_AttachChangeDetector(&pipeline, &detector);
+
+    for (index = 0U; index < 6U; index++)
+    {
+        samples[index].timestamp = index;
+        samples[index].channel = 0U;
+        samples[index].status = RTD_SAMPLE_OK;
+        samples[index].value = (index < 5U) ? RTD_CalculateResistance(RTD_SENSOR_PT100, levels[index]) : 1.0e4;
+    }
+
+    RTD_CHECK(RTD_Ring_Push(&input, samples, 6U) == 6U);
+    RTD_CHECK(RTD_Pipeline_Process(&pipeline, 6U) == 6U);
+    RTD_CHECK(RTD_Ring_Pop(&output, samples, 6U) == 6U);
+
+    for (index = 0U; index < 6U; index++)
+    {
+        RTD_CHECK(samples[index].status == expected[index]);
+    }
+}
+
+
+int main(void)
+{
+    TestVoter();
+    TestMonitor();
+    TestChangeDetector();
+    TestChangePipeline();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_diag.c */
@@ -0,0 +1,309 @@
+/**
+ * @file    test_filter.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the priming and DC gain of the filter stages and the validation of filter chains.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_filter.h"      ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_CHANNEL_COUNT  3U       /**< Channels of the filters         */
+#define  TEST_LENGTH         4U       /**< Moving-average window (frames)  */
+#define  TEST_SECTIONS       2U       /**< Biquad sections                 */
+#define  TEST_SETTLE_COUNT   400U     /**< Frames for a step to settle     */
+#define  TEST_INTERVAL       0.1      /**< Sample interval (s)             */
+#define  TEST_TOLERANCE      1.0e-9   /**< Accepted error (°C)             */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static double history[TEST_LENGTH * TEST_CHANNEL_COUNT];
+static double sum[TEST_CHANNEL_COUNT];
+static double fill[TEST_CHANNEL_COUNT];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Failed samples before the first valid one do not enter the window.
+ */
+static void TestMovingAveragePriming(void)
+{
+    uint32_t frame = 0U;
+    double values[TEST_CHANNEL_COUNT];
+    RTD_MovingAverage_t filter;
+
+    RTD_CHECK(RTD_MovingAverage_Init(&filter, history, sum, fill, TEST_CHANNEL_COUNT, TEST_LENGTH) == 1U);
+
+    /* Channel 0 fails in its first frame, channel 1 in its first five, channel 2 never */
+    values[0] = RTD_CONVERSION_FAILED;
+    values[1] = RTD_CONVERSION_FAILED;
+    values[2] = 10.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK(values[0] == RTD_CONVERSION_FAILED);
+    RTD_CHECK(values[1] == RTD_CONVERSION_FAILED);
+    RTD_CHECK_NEAR(values[2], 10.0, TEST_TOLERANCE);
+
+    values[0] = 100.0;
+    values[1] = RTD_CONVERSION_FAILED;
+    values[2] = 20.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK_NEAR(values[0], 100.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(values[2], 15.0, TEST_TOLERANCE);
+
+    /* Channel 1 primes after the window has wrapped */
+    for (frame = 0U; frame < 3U; frame++)
+    {
+        values[0] = 100.0;
+        values[1] = RTD_CONVERSION_FAILED;
+        values[2] = 20.0;
+        RTD_MovingAverage_Process(&filter, values);
+    }
+
+    values[0] = 100.0;
+    values[1] = -50.0;
+    values[2] = 20.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK_NEAR(values[0], 100.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(values[1], -50.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(values[2], 20.0, TEST_TOLERANCE);
+
+    values[0] = 100.0;
+    values[1] = -30.0;
+    values[2] = 20.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK_NEAR(values[1], -40.0, TEST_TOLERANCE);
+
+    /* A failed sample of a primed channel enters as the current average */
+    values[0] = 100.0;
+    values[1] = RTD_CONVERSION_FAILED;
+    values[2] = 20.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK(values[1] == RTD_CONVERSION_FAILED);
+
+    values[1] = -40.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK_NEAR(values[1], -40.0, TEST_TOLERANCE);
+
+    /* The window of channel 1 is full from here on */
+    values[1] = 0.0;
+    RTD_MovingAverage_Process(&filter, values);
+    RTD_CHECK_NEAR(values[1], -27.5, TEST_TOLERANCE);
+}
+
+/**
+ * @brief Biquad cascade: steady-state priming, unity DC gain and failed samples.
+ */
+static void TestBiquad(void)
+{
+    uint32_t frame = 0U, section = 0U;
+    double state[2U * TEST_SECTIONS * 2U];
+    double values[2];
+    double coefficients[5U * TEST_SECTIONS];
+    const double unstable[5] = {1.0, 0.0, 0.0, -2.0, 1.0};
+    RTD_Biquad_t filter;
+
+    /* Two low-pass sections with numerators scaled to a DC gain of exactly 1 */
+    coefficients[3] = -1.1429805;
+    coefficients[4] = 0.4128016;
+    coefficients[8] = -0.6;
+    coefficients[9] = 0.2;
+
+    for (section = 0U; section < TEST_SECTIONS; section++)
+    {
+        coefficients[(5U * section) + 0U] = 0.25 * (1.0 + coefficients[(5U * section) + 3U] + coefficients[(5U * section) + 4U]);
+        coefficients[(5U * section) + 1U] = 0.50 * (1.0 + coefficients[(5U * section) + 3U] + coefficients[(5U * section) + 4U]);
+        coefficients[(5U * section) + 2U] = coefficients[5U * section];
+    }
+
+    RTD_CHECK(RTD_Biquad_Init(&filter, state, unstable, 1U, 2U) == 0U);
+    RTD_CHECK(RTD_Biquad_Init(&filter, state, coefficients, TEST_SECTIONS, 2U) == 1U);
+
+    /* Each channel is primed in steady state by its first valid sample */
+    values[0] = 25.0;
+    values[1] = RTD_CONVERSION_FAILED;
+    RTD_Biquad_Process(&filter, values);
+    RTD_CHECK_NEAR(values[0], 25.0, TEST_TOLERANCE);
+    RTD_CHECK(values[1] == RTD_CONVERSION_FAILED);
+
+    for (frame = 0U; frame < 10U; frame++)
+    {
+        values[0] = 25.0;
+        values[1] = -80.0;
+        RTD_Biquad_Process(&filter, values);
+        RTD_CHECK_NEAR(values[0], 25.0, TEST_TOLERANCE);
+        RTD_CHECK_NEAR(values[1], -80.0, TEST_TOLERANCE);
+    }
+
+    /* A step is smoothed and settles at its new level; failed samples pass through */
+    values[0] = 35.0;
+    RTD_Biquad_Process(&filter, values);
+    RTD_CHECK( (values[0] > 25.0) && (values[0] < 30.0) );
+
+    for (frame = 0U; frame < TEST_SETTLE_COUNT; frame++)
+    {
+        values[0] = ((frame % 50U) == 0U) ? RTD_CONVERSION_FAILED : 35.0;
+        values[1] = -80.0;
+        RTD_Biquad_Process(&filter, values);
+    }
+
+    RTD_CHECK_NEAR(values[0], 35.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(values[1], -80.0, TEST_TOLERANCE);
+}
+
+/**
+ * @brief Kalman filter: priming, unity DC gain, rate of a ramp and failed samples.
+ */
+static void TestKalman(void)
+{
+    uint32_t frame = 0U;
+    double temperature[2];
+    double rate[2];
+    double covariance[3U * 2U];
+    double values[2];
+    RTD_Kalman_t filter;
+
+    RTD_CHECK(RTD_Kalman_Init(&filter, RTD_SENSOR_PT100, temperature, rate, covariance, 2U, 0.0, 1.0e-3, 1.0e-4) == 0U);
+    RTD_CHECK(RTD_Kalman_Init(&filter, RTD_SENSOR_PT100, temperature, rate, covariance, 2U, 0.1, 1.0e-3, 1.0e-4) == 1U);
+
+    values[0] = 100.0;
+    values[1] = RTD_CONVERSION_FAILED;
+    RTD_Kalman_Process(&filter, values);
+    RTD_CHECK( (values[0] == 100.0) && (rate[0] == 0.0) );
+    RTD_CHECK( (values[1] == RTD_CONVERSION_FAILED) && (temperature[1] == RTD_CONVERSION_FAILED) );
+
+    /* Channel 0 steps to 20°C; channel 1 ramps at 0.5 K/s */
+    for (frame = 0U; frame < TEST_SETTLE_COUNT; frame++)
+    {
+        values[0] = ((frame % 50U) == 25U) ? RTD_CONVERSION_FAILED : 20.0;
+        values[1] = -100.0 + (0.05 * (double)frame);
+        RTD_Kalman_Process(&filter, values);
+    }
+
+    RTD_CHECK_NEAR(values[0], 20.0, 1.0e-6);
+    RTD_CHECK_NEAR(rate[0], 0.0, 1.0e-6);
+    RTD_CHECK_NEAR(values[1], -100.0 + (0.05 * (double)(TEST_SETTLE_COUNT - 1U)), 1.0e-6);
+    RTD_CHECK_NEAR(rate[1], 0.5, 1.0e-6);
+
+    /* A failed sample passes through and the estimate follows the prediction */
+    values[0] = RTD_CONVERSION_FAILED;
+    values[1] = RTD_CONVERSION_FAILED;
+    RTD_Kalman_Process(&filter, values);
+    RTD_CHECK( (values[0] == RTD_CONVERSION_FAILED) && (values[1] == RTD_CONVERSION_FAILED) );
+    RTD_CHECK_NEAR(temperature[1], -100.0 + (0.05 * (double)TEST_SETTLE_COUNT), 1.0e-6);
+}
+
+/**
+ * @brief Lag compensation of simulated first-order sensors gives the response of the filter time constant.
+ */
+static void TestLagCompensator(void)
+{
+    uint32_t frame = 0U, channel = 0U;
+    double input[2];
+    double output[2];
+    double zero[2];
+    double gain[2];
+    double sensors[2];
+    double values[2];
+    double process = 20.0, reference = 20.0, pole = exp(-TEST_INTERVAL / 1.0);
+    const double time_constants[2] = {10.0, 0.0};
+    RTD_LagCompensator_t compensator;
+
+    RTD_CHECK(RTD_LagCompensator_Init(&compensator, input, output, zero, gain, time_constants, 2U, TEST_INTERVAL, 0.0) == 0U);
+    RTD_CHECK(RTD_LagCompensator_Init(&compensator, input, output, zero, gain, time_constants, 2U, TEST_INTERVAL, 1.0) == 1U);
+    RTD_CHECK(RTD_LagCompensator_SetChannel(&compensator, 1U, -1.0) == 0U);
+    RTD_CHECK(RTD_LagCompensator_SetChannel(&compensator, 2U, 3.0) == 0U);
+    RTD_CHECK(RTD_LagCompensator_SetChannel(&compensator, 1U, 3.0) == 1U);
+
+    /* Both sensors start in steady state at 20°C; the process steps to 30°C at frame 5 */
+    sensors[0] = process;
+    sensors[1] = process;
+
+    for (frame = 0U; frame < 100U; frame++)
+    {
+        process = (frame < 5U) ? 20.0 : 30.0;
+        reference = (frame == 0U) ? process : ((pole * reference) + ((1.0 - pole) * process));
+
+        for (channel = 0U; channel < 2U; channel++)
+        {
+            sensors[channel] = (frame == 0U) ? process : ((zero[channel] * sensors[channel]) + ((1.0 - zero[channel]) * process));
+            values[channel] = sensors[channel];
+        }
+
+        RTD_LagCompensator_Process(&compensator, values);
+        RTD_CHECK_NEAR(values[0], reference, TEST_TOLERANCE);
+        RTD_CHECK_NEAR(values[1], reference, TEST_TOLERANCE);
+    }
+
+    /* The slow sensor alone is still far from the process, the compensated output is not */
+    RTD_CHECK( (sensors[0] < 27.0) && (values[0] > 29.9) );
+
+    /* A failed sample passes through without changing the state */
+    values[0] = RTD_CONVERSION_FAILED;
+    values[1] = sensors[1];
+    RTD_LagCompensator_Process(&compensator, values);
+    RTD_CHECK( (values[0] == RTD_CONVERSION_FAILED) && (input[0] == sensors[0]) );
+}
+
+/**
+ * @brief Fused conversion and filtering with a failed first frame.
+ */
+static void TestConvertFrames(void)
+{
+    double resistances[2U * TEST_CHANNEL_COUNT];
+    double temperatures[2U * TEST_CHANNEL_COUNT];
+    double state[TEST_CHANNEL_COUNT];
+    RTD_Iir1_t iir;
+    RTD_MovingAverage_t filter;
+    RTD_FilterChain_t chain = {NULL, NULL, NULL, NULL, NULL};
+
+    RTD_CHECK(RTD_MovingAverage_Init(&filter, history, sum, fill, TEST_CHANNEL_COUNT, TEST_LENGTH) == 1U);
+    chain.moving_average = &filter;
+
+    resistances[0] = 1.0e4;
+    resistances[1] = RTD_CalculateResistance(RTD_SENSOR_PT100, 0.0);
+    resistances[2] = RTD_CalculateResistance(RTD_SENSOR_PT100, 0.0);
+    resistances[3] = RTD_CalculateResistance(RTD_SENSOR_PT100, 100.0);
+    resistances[4] = RTD_CalculateResistance(RTD_SENSOR_PT100, 100.0);
+    resistances[5] = RTD_CalculateResistance(RTD_SENSOR_PT100, 100.0);
+
+    RTD_CHECK(RTD_Filter_ConvertFrames(RTD_SENSOR_PT100, &chain, resistances, temperatures, 2U, TEST_CHANNEL_COUNT) == 5U);
+    RTD_CHECK(temperatures[0] == RTD_CONVERSION_FAILED);
+    RTD_CHECK_NEAR(temperatures[3], 100.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(temperatures[4], 50.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(temperatures[5], 50.0, TEST_TOLERANCE);
+
+    /* A stage with a different channel count rejects the whole call */
+    RTD_CHECK(RTD_Iir1_Init(&iir, state, TEST_CHANNEL_COUNT - 1U, 0.5) == 1U);
+    chain.iir = &iir;
+    temperatures[0] = 0.0;
+    RTD_CHECK(RTD_Filter_ConvertFrames(RTD_SENSOR_PT100, &chain, resistances, temperatures, 2U, TEST_CHANNEL_COUNT) == 0U);
+    RTD_CHECK(temperatures[0] == 0.0);
+}
+
+
+int main(void)
+{
+    TestMovingAveragePriming();
+    TestBiquad();
+    TestKalman();
+    TestLagCompensator();
+    TestConvertFrames();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_filter.c */
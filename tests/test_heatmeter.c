@@ -0,0 +1,157 @@
+/**
+ * @file    test_heatmeter.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks heat-meter temperature differences against the double-double reference.
+ *
+ * @details
+ * Pairs 1 K apart, in both orders, cover every integer temperature of the range, so both
+ * branches of the curve and the pairs across 0°C are included. The reference difference is
+ * @c RTD_CalculateTemperaturePrecise of the supply minus that of the return resistance.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_heatmeter.h"   ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_PAIR_COUNT  2098U       /**< -200°C to +848°C, both orders          */
+#define  TEST_TOLERANCE   1.0e-9      /**< Accepted error of the difference (K)   */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static double supply_resistances[TEST_PAIR_COUNT];
+static double return_resistances[TEST_PAIR_COUNT];
+static double references[TEST_PAIR_COUNT];
+static double differences[TEST_PAIR_COUNT];
+static double volumes[TEST_PAIR_COUNT];
+static double heat_coefficients[TEST_PAIR_COUNT];
+static double energies[TEST_PAIR_COUNT];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Exact temperature of a rounded resistance.
+ */
+static double ReferenceTemperature(double resistance)
+{
+    RTD_Precise_t value = {0.0, 0.0};
+
+    value.hi = resistance;
+    value = RTD_CalculateTemperaturePrecise(RTD_SENSOR_PT100, value);
+
+    return value.hi + value.lo;
+}
+
+/**
+ * @brief Fills the pairs: supply 1 K below and 1 K above the return temperature.
+ */
+static void FillPairs(void)
+{
+    uint32_t index = 0U;
+    double lower = 0.0, upper = 0.0;
+
+    for (index = 0U; index < (TEST_PAIR_COUNT / 2U); index++)
+    {
+        lower = RTD_CalculateResistance(RTD_SENSOR_PT100, -200.0 + (double)index);
+        upper = RTD_CalculateResistance(RTD_SENSOR_PT100, -199.0 + (double)index);
+        supply_resistances[2U * index] = lower;
+        return_resistances[2U * index] = upper;
+        supply_resistances[(2U * index) + 1U] = upper;
+        return_resistances[(2U * index) + 1U] = lower;
+    }
+
+    for (index = 0U; index < TEST_PAIR_COUNT; index++)
+    {
+        references[index] = ReferenceTemperature(supply_resistances[index]) - ReferenceTemperature(return_resistances[index]);
+        volumes[index] = 0.5;
+        heat_coefficients[index] = 1.16;
+    }
+}
+
+/**
+ * @brief Differences of adjacent pairs and pairs across 0°C.
+ */
+static void TestDifference(void)
+{
+    uint32_t index = 0U;
+    double supply[3] = {0.0, 0.0, 0.0}, return_[3] = {0.0, 0.0, 0.0}, result[3] = {0.0, 0.0, 0.0};
+
+    RTD_CHECK(RTD_HeatMeter_CalculateDifference(RTD_SENSOR_PT100, supply_resistances, return_resistances, differences, TEST_PAIR_COUNT) ==
+              TEST_PAIR_COUNT);
+
+    for (index = 0U; index < TEST_PAIR_COUNT; index++)
+    {
+        RTD_CHECK_NEAR(differences[index], references[index], TEST_TOLERANCE);
+    }
+
+    /* Across 0°C, equal resistances, and an out-of-range pair */
+    supply[0] = RTD_CalculateResistance(RTD_SENSOR_PT100, 70.0);
+    return_[0] = RTD_CalculateResistance(RTD_SENSOR_PT100, -30.0);
+    supply[1] = RTD_CalculateResistance(RTD_SENSOR_PT100, -5.0);
+    return_[1] = supply[1];
+    supply[2] = 1.0e4;
+    return_[2] = return_[0];
+
+    RTD_CHECK(RTD_HeatMeter_CalculateDifference(RTD_SENSOR_PT100, supply, return_, result, 3U) == 2U);
+    RTD_CHECK_NEAR(result[0], ReferenceTemperature(supply[0]) - ReferenceTemperature(return_[0]), TEST_TOLERANCE);
+    RTD_CHECK(result[1] == 0.0);
+    RTD_CHECK(result[2] == RTD_CONVERSION_FAILED);
+}
+
+/**
+ * @brief Interval energies with and without the optional differences.
+ */
+static void TestEnergy(void)
+{
+    uint32_t index = 0U;
+
+    RTD_CHECK(RTD_HeatMeter_CalculateEnergy(RTD_SENSOR_PT100, supply_resistances, return_resistances, volumes, heat_coefficients,
+                                            energies, NULL, TEST_PAIR_COUNT) == TEST_PAIR_COUNT);
+
+    for (index = 0U; index < TEST_PAIR_COUNT; index++)
+    {
+        RTD_CHECK_NEAR(energies[index], 1.16 * 0.5 * references[index], TEST_TOLERANCE);
+        differences[index] = 0.0;
+    }
+
+    RTD_CHECK(RTD_HeatMeter_CalculateEnergy(RTD_SENSOR_PT100, supply_resistances, return_resistances, volumes, heat_coefficients,
+                                            energies, differences, TEST_PAIR_COUNT) == TEST_PAIR_COUNT);
+
+    for (index = 0U; index < TEST_PAIR_COUNT; index++)
+    {
+        RTD_CHECK_NEAR(differences[index], references[index], TEST_TOLERANCE);
+        RTD_CHECK(energies[index] == (1.16 * 0.5 * differences[index]));
+    }
+
+    /* A failed pair has zero energy and is not counted */
+    supply_resistances[0] = 1.0e4;
+    RTD_CHECK(RTD_HeatMeter_CalculateEnergy(RTD_SENSOR_PT100, supply_resistances, return_resistances, volumes, heat_coefficients,
+                                            energies, differences, 2U) == 1U);
+    RTD_CHECK(energies[0] == 0.0);
+    RTD_CHECK(differences[0] == RTD_CONVERSION_FAILED);
+}
+
+
+int main(void)
+{
+    FillPairs();
+    TestDifference();
+    TestEnergy();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_heatmeter.c */
@@ -0,0 +1,268 @@
+/**
+ * @file    test_prefilter.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the resistance-domain decimator, the Hampel spike filter and the current
+ *          reversal stage.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_prefilter.h"   ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_CHANNEL_COUNT  2U        /**< Channels of every stage                    */
+#define  TEST_FACTOR         8U        /**< Decimation factor                          */
+#define  TEST_FRAME_COUNT    16U       /**< Input frames of the decimator (2 windows)  */
+#define  TEST_WINDOW         5U        /**< Hampel window length                       */
+#define  TEST_CLEAN_COUNT    40U       /**< Frames of the clean Hampel series          */
+#define  TEST_PAIR_COUNT     3U        /**< Forward/reverse pairs of the reversal test  */
+#define  TEST_TOLERANCE      1.0e-9    /**< Accepted conversion difference (K)         */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static double frames[TEST_FRAME_COUNT * TEST_CHANNEL_COUNT];
+static double means[2U * TEST_CHANNEL_COUNT];
+static double resistance_means[2U * TEST_CHANNEL_COUNT];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Fills two decimation windows of temperature ramps; channel 1 leaves the range in window 1.
+ */
+static void FillRamps(void)
+{
+    uint32_t frame = 0U, channel = 0U, output = 0U;
+    double temperature = 0.0;
+
+    for (output = 0U; output < (2U * TEST_CHANNEL_COUNT); output++)
+    {
+        means[output] = 0.0;
+        resistance_means[output] = 0.0;
+    }
+
+    for (frame = 0U; frame < TEST_FRAME_COUNT; frame++)
+    {
+        for (channel = 0U; channel < TEST_CHANNEL_COUNT; channel++)
+        {
+            temperature = (channel == 0U) ? (100.0 + (20.0 * (double)frame)) : (-190.0 + (5.0 * (double)frame));
+            output = ((frame / TEST_FACTOR) * TEST_CHANNEL_COUNT) + channel;
+            frames[(frame * TEST_CHANNEL_COUNT) + channel] = RTD_CalculateResistance(RTD_SENSOR_PT100, temperature);
+            means[output] += temperature / (double)TEST_FACTOR;
+            resistance_means[output] += frames[(frame * TEST_CHANNEL_COUNT) + channel] / (double)TEST_FACTOR;
+        }
+    }
+
+    /* Window 1 of channel 1 averages far below -200°C */
+    for (frame = TEST_FACTOR; frame < TEST_FRAME_COUNT; frame++)
+    {
+        frames[(frame * TEST_CHANNEL_COUNT) + 1U] = 1.0;
+    }
+}
+
+/**
+ * @brief Decimated means of temperature ramps with and without the curvature correction.
+ */
+static void TestDecimator(void)
+{
+    uint32_t output = 0U;
+    double reference[TEST_CHANNEL_COUNT];
+    double sum[TEST_CHANNEL_COUNT];
+    double sum_squares[TEST_CHANNEL_COUNT];
+    double temperatures[3U * TEST_CHANNEL_COUNT];
+    RTD_Decimator_t decimator;
+
+    FillRamps();
+    RTD_CHECK(RTD_Decimator_Init(&decimator, RTD_SENSOR_PT100, reference, sum, sum_squares, TEST_CHANNEL_COUNT, 0U, 1U) == 0U);
+
+    /* Uncorrected: the temperature of the mean resistance, which the curvature pulls off the mean */
+    RTD_CHECK(RTD_Decimator_Init(&decimator, RTD_SENSOR_PT100, reference, sum, sum_squares, TEST_CHANNEL_COUNT, TEST_FACTOR, 0U) == 1U);
+    RTD_CHECK(RTD_Decimator_Process(&decimator, frames, TEST_FRAME_COUNT, temperatures) == 2U);
+    RTD_CHECK_NEAR(temperatures[0], RTD_CalculateTemperature(RTD_SENSOR_PT100, resistance_means[0], 25.0), TEST_TOLERANCE);
+    RTD_CHECK_NEAR(temperatures[2], RTD_CalculateTemperature(RTD_SENSOR_PT100, resistance_means[2], 25.0), TEST_TOLERANCE);
+    RTD_CHECK( ((means[0] - temperatures[0]) > 0.1) && ((means[2] - temperatures[2]) > 0.1) );
+    RTD_CHECK(temperatures[3] == RTD_CONVERSION_FAILED);
+
+    /* Corrected, with the windows split across three calls */
+    RTD_CHECK(RTD_Decimator_Init(&decimator, RTD_SENSOR_PT100, reference, sum, sum_squares, TEST_CHANNEL_COUNT, TEST_FACTOR, 1U) == 1U);
+    RTD_CHECK(RTD_Decimator_Process(&decimator, frames, 5U, temperatures) == 0U);
+    RTD_CHECK(RTD_Decimator_Process(&decimator, &frames[5U * TEST_CHANNEL_COUNT], 10U, temperatures) == 1U);
+    RTD_CHECK(RTD_Decimator_Process(&decimator, &frames[15U * TEST_CHANNEL_COUNT], 1U, &temperatures[TEST_CHANNEL_COUNT]) == 1U);
+
+    for (output = 0U; output < 3U; output++)
+    {
+        RTD_CHECK_NEAR(temperatures[output], means[output], 1.0e-3);
+    }
+
+    RTD_CHECK(temperatures[3] == RTD_CONVERSION_FAILED);
+}
+
+/**
+ * @brief Returns the median of a window of @c TEST_WINDOW samples.
+ */
+static double Median(const double *window)
+{
+    uint32_t index = 0U, other = 0U;
+    double swap = 0.0;
+    double sorted[TEST_WINDOW];
+
+    for (index = 0U; index < TEST_WINDOW; index++)
+    {
+        sorted[index] = window[index];
+    }
+
+    for (index = 1U; index < TEST_WINDOW; index++)
+    {
+        for (other = index; (other > 0U) && (sorted[other - 1U] > sorted[other]); other--)
+        {
+            swap = sorted[other];
+            sorted[other] = sorted[other - 1U];
+            sorted[other - 1U] = swap;
+        }
+    }
+
+    return sorted[TEST_WINDOW / 2U];
+}
+
+/**
+ * @brief Clean series pass unchanged; a spike is replaced by the window median; a step is followed.
+ */
+static void TestHampel(void)
+{
+    uint32_t frame = 0U;
+    uint32_t mask[1] = {0U};
+    double history[TEST_WINDOW * TEST_CHANNEL_COUNT];
+    double window[TEST_WINDOW];
+    double resistances[TEST_CHANNEL_COUNT];
+    double cleaned[TEST_CHANNEL_COUNT];
+    RTD_Hampel_t filter;
+
+    RTD_CHECK(RTD_Hampel_Init(&filter, history, TEST_CHANNEL_COUNT, 4U, 3.0, 0.01) == 0U);
+    RTD_CHECK(RTD_Hampel_Init(&filter, history, TEST_CHANNEL_COUNT, TEST_WINDOW, 3.0, 0.01) == 1U);
+
+    /* Channel 0 is noisy around 100 ohms, channel 1 a slow ramp */
+    for (frame = 0U; frame < TEST_CLEAN_COUNT; frame++)
+    {
+        resistances[0] = 100.0 + (0.004 * (double)((frame * 7U) % 5U));
+        resistances[1] = 110.0 + (0.002 * (double)frame);
+        window[frame % TEST_WINDOW] = resistances[0];
+
+        RTD_CHECK(RTD_Hampel_Process(&filter, resistances, cleaned, mask) == 0U);
+        RTD_CHECK( (cleaned[0] == resistances[0]) && (cleaned[1] == resistances[1]) && (mask[0] == 0x3U) );
+    }
+
+    /* A spike on channel 0 is replaced by the median of the window that contains it */
+    resistances[0] = 105.0;
+    resistances[1] += 0.002;
+    window[TEST_CLEAN_COUNT % TEST_WINDOW] = resistances[0];
+    RTD_CHECK(RTD_Hampel_Process(&filter, resistances, cleaned, mask) == 1U);
+    RTD_CHECK( (cleaned[0] == Median(window)) && (cleaned[1] == resistances[1]) && (mask[0] == 0x2U) );
+
+    resistances[0] = 100.004;
+    RTD_CHECK(RTD_Hampel_Process(&filter, resistances, resistances, mask) == 0U);
+    RTD_CHECK( (resistances[0] == 100.004) && (mask[0] == 0x3U) );
+
+    /* A genuine step is rejected until it holds the majority of the window */
+    resistances[1] = 120.0;
+    RTD_CHECK(RTD_Hampel_Process(&filter, resistances, NULL, mask) == 1U);
+    RTD_CHECK(RTD_Hampel_Process(&filter, resistances, NULL, mask) == 1U);
+    RTD_CHECK(RTD_Hampel_Process(&filter, resistances, NULL, mask) == 0U);
+    RTD_CHECK( (mask[0] == 0x3U) && (filter.rejected == 3U) );
+}
+
+/**
+ * @brief Fills alternating forward and reverse frames and the expected temperature of each pair.
+ */
+static void FillReversal(double *readings, double *expected)
+{
+    uint32_t pair = 0U, channel = 0U;
+    double resistance = 0.0, emf = 0.0, forward = 0.0, reverse = 0.0;
+
+    for (pair = 0U; pair < TEST_PAIR_COUNT; pair++)
+    {
+        for (channel = 0U; channel < TEST_CHANNEL_COUNT; channel++)
+        {
+            resistance = RTD_CalculateResistance(RTD_SENSOR_PT100, (channel == 0U) ? (50.0 + (double)pair) : (-100.0 - (double)pair));
+            emf = (channel == 0U) ? 0.3 : -0.2;
+            forward = resistance + emf;
+            reverse = emf - resistance;
+            readings[(((2U * pair) + 0U) * TEST_CHANNEL_COUNT) + channel] = forward;
+            readings[(((2U * pair) + 1U) * TEST_CHANNEL_COUNT) + channel] = reverse;
+            expected[(pair * TEST_CHANNEL_COUNT) + channel] = 0.5 * (forward - reverse);
+        }
+    }
+
+    (void)RTD_CalculateTemperatureBatch(RTD_SENSOR_PT100, expected, expected, TEST_PAIR_COUNT * TEST_CHANNEL_COUNT);
+}
+
+/**
+ * @brief Current reversal in one call, with a pair split across calls, and in place.
+ */
+static void TestReversal(void)
+{
+    uint32_t output = 0U;
+    double forward[TEST_CHANNEL_COUNT];
+    double offset[TEST_CHANNEL_COUNT];
+    double readings[2U * TEST_PAIR_COUNT * TEST_CHANNEL_COUNT];
+    double expected[TEST_PAIR_COUNT * TEST_CHANNEL_COUNT];
+    double temperatures[TEST_PAIR_COUNT * TEST_CHANNEL_COUNT];
+    RTD_Reversal_t reversal;
+
+    FillReversal(readings, expected);
+    RTD_CHECK(RTD_Reversal_Init(&reversal, RTD_SENSOR_PT100, NULL, offset, TEST_CHANNEL_COUNT) == 0U);
+    RTD_CHECK(RTD_Reversal_Init(&reversal, RTD_SENSOR_PT100, forward, offset, TEST_CHANNEL_COUNT) == 1U);
+
+    RTD_CHECK(RTD_Reversal_Process(&reversal, readings, 2U * TEST_PAIR_COUNT, temperatures) == TEST_PAIR_COUNT);
+    for (output = 0U; output < (TEST_PAIR_COUNT * TEST_CHANNEL_COUNT); output++)
+    {
+        RTD_CHECK(temperatures[output] == expected[output]);
+    }
+
+    RTD_CHECK_NEAR(temperatures[0], 50.0, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(temperatures[TEST_CHANNEL_COUNT + 1U], -101.0, TEST_TOLERANCE);
+    RTD_CHECK( (fabs(offset[0] - 0.3) < 1.0e-12) && (fabs(offset[1] + 0.2) < 1.0e-12) );
+
+    /* The second pair spans two calls */
+    RTD_CHECK(RTD_Reversal_Process(&reversal, readings, 3U, temperatures) == 1U);
+    RTD_CHECK(RTD_Reversal_Process(&reversal, &readings[3U * TEST_CHANNEL_COUNT], 3U, &temperatures[TEST_CHANNEL_COUNT]) == 2U);
+    for (output = 0U; output < (TEST_PAIR_COUNT * TEST_CHANNEL_COUNT); output++)
+    {
+        RTD_CHECK(temperatures[output] == expected[output]);
+    }
+
+    /* In place, with a split pair; a channel out of range fails on its own */
+    readings[1] = 1.0e4;
+    RTD_CHECK(RTD_Reversal_Process(&reversal, readings, 3U, readings) == 1U);
+    RTD_CHECK(RTD_Reversal_Process(&reversal, &readings[3U * TEST_CHANNEL_COUNT], 3U, &readings[TEST_CHANNEL_COUNT]) == 2U);
+    RTD_CHECK(readings[1] == RTD_CONVERSION_FAILED);
+    for (output = 2U; output < (TEST_PAIR_COUNT * TEST_CHANNEL_COUNT); output++)
+    {
+        RTD_CHECK(readings[output] == expected[output]);
+    }
+
+    RTD_CHECK(readings[0] == expected[0]);
+}
+
+
+int main(void)
+{
+    TestDecimator();
+    TestHampel();
+    TestReversal();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_prefilter.c */
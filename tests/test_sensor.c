@@ -0,0 +1,116 @@
+/**
+ * @file    test_sensor.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the scalar and lead-compensated conversions against reference values.
+ *
+ * @details
+ * Below 0°C the Newton iteration of @c RTD_CalculateTemperature needs the exact derivative of
+ * the C term to reach the reference within the tolerance of its stopping rule; a wrong
+ * derivative converges linearly and stops a few 1e-10 K away from the root.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_sensor.h"      ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_STEP_COUNT  20001U      /**< -200°C to 0°C in 0.01 K steps                 */
+#define  TEST_TOLERANCE   1.0e-11     /**< Accepted round-trip error (°C)                */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Sub-zero round trip through the scalar Newton conversion.
+ */
+static void TestSubZeroRoundTrip(uint16_t sensor_type)
+{
+    uint32_t index = 0U;
+    double temperature = 0.0;
+    RTD_Precise_t reference = {0.0, 0.0}, resistance = {0.0, 0.0};
+
+    for (index = 0U; index < TEST_STEP_COUNT; index++)
+    {
+        reference.hi = -200.0 + (0.01 * (double)index);
+        reference.lo = 0.0;
+        resistance = RTD_CalculateResistancePrecise(sensor_type, reference);
+
+        /* The reference is the exact temperature of the rounded input */
+        resistance.lo = 0.0;
+        reference = RTD_CalculateTemperaturePrecise(sensor_type, resistance);
+
+        temperature = RTD_CalculateTemperature(sensor_type, resistance.hi, 25.0);
+        RTD_CHECK_NEAR(temperature, reference.hi + reference.lo, TEST_TOLERANCE);
+    }
+}
+
+/**
+ * @brief Sensitivity against a central difference of the forward function.
+ */
+static void TestSensitivity(void)
+{
+    const double step = 1.0e-3;
+    double temperature = 0.0, difference = 0.0;
+
+    for (temperature = -200.0 + step; temperature < 850.0; temperature += 12.5)
+    {
+        difference = (RTD_CalculateResistance(RTD_SENSOR_PT100, temperature + step) -
+                      RTD_CalculateResistance(RTD_SENSOR_PT100, temperature - step)) / (2.0 * step);
+        RTD_CHECK_NEAR(RTD_CalculateSensitivity(RTD_SENSOR_PT100, temperature), difference, 1.0e-8);
+    }
+}
+
+/**
+ * @brief Lead-wire compensation of each wiring mode.
+ */
+static void TestWired(void)
+{
+    const double lead_resistance[5] = {2.0, 0.5, 2.0, 2.0, 2.0};
+    const double lead_coefficient[5] = {0.004, 0.004, 0.004, 0.004, 0.004};
+    const uint8_t mode[5] = {RTD_WIRING_2_WIRE, RTD_WIRING_3_WIRE, RTD_WIRING_4_WIRE, 0U, 5U};
+    const RTD_Wiring_t wiring = {lead_resistance, lead_coefficient, mode, 20.0};
+    const double element = RTD_CalculateResistance(RTD_SENSOR_PT100, 50.0);
+    double resistances[5];
+    double temperatures[5];
+
+    /* Leads at 45°C: 10% above their resistance at 20°C */
+    resistances[0] = element + (2.0 * 1.1);
+    resistances[1] = element + (0.5 * 1.1);
+    resistances[2] = element;
+    resistances[3] = element;
+    resistances[4] = element;
+
+    RTD_CHECK(RTD_CalculateTemperatureWired(RTD_SENSOR_PT100, &wiring, resistances, temperatures, 5U, 45.0) == 3U);
+    RTD_CHECK_NEAR(temperatures[0], 50.0, 1.0e-9);
+    RTD_CHECK_NEAR(temperatures[1], 50.0, 1.0e-9);
+    RTD_CHECK_NEAR(temperatures[2], 50.0, 1.0e-9);
+    RTD_CHECK(temperatures[3] == RTD_CONVERSION_FAILED);
+    RTD_CHECK(temperatures[4] == RTD_CONVERSION_FAILED);
+}
+
+
+int main(void)
+{
+    TestSubZeroRoundTrip(RTD_SENSOR_PT100);
+    TestSubZeroRoundTrip(RTD_SENSOR_PT1000);
+    TestSensitivity();
+    TestWired();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_sensor.c */
@@ -0,0 +1,289 @@
+/**
+ * @file    test_stats.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the resistance-domain histograms, the statistics of ADC-code histograms and
+ *          the rollup windows.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include <math.h>                     ///< nextafter, NAN
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_stats.h"       ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_BIN_COUNT   7U           /**< Bins of the histograms (not a power of two)   */
+#define  TEST_CODE_COUNT  64U          /**< Codes of the ADC histogram                    */
+#define  TEST_TOLERANCE   1.0e-9       /**< Accepted difference of the statistics (K)     */
+#define  TEST_LEVEL_COUNT 2U           /**< Levels of the rollup                          */
+#define  TEST_CHANNELS    2U           /**< Channels of the rollup                        */
+#define  TEST_FIRST_TIME  100U         /**< Timestamp of the first rollup frame           */
+#define  TEST_FRAME_COUNT 80U          /**< Frames added to the rollup                    */
+#define  TEST_RECORDS     8U           /**< Record capacity of the rollup                 */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static const double temperature_edges[TEST_BIN_COUNT + 1U] = {-50.0, -10.0, 0.0, 25.0, 60.0, 100.0, 250.0, 400.0};
+
+static const uint64_t rollup_periods[TEST_LEVEL_COUNT] = {10U, 40U};
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Binning exactly at and just below every edge, and merging of two histograms.
+ */
+static void TestHistogram(void)
+{
+    uint32_t edge = 0U, bin = 0U;
+    double resistance_edges[TEST_BIN_COUNT + 1U];
+    double other_edges[TEST_BIN_COUNT + 1U];
+    uint64_t counts[TEST_BIN_COUNT];
+    uint64_t other_counts[TEST_BIN_COUNT];
+    double resistances[2];
+    const double descending[3] = {0.0, 100.0, 50.0};
+    RTD_Histogram_t histogram;
+    RTD_Histogram_t other;
+
+    RTD_CHECK(RTD_Histogram_Init(&histogram, RTD_SENSOR_PT100, descending, 2U, resistance_edges, counts) == 0U);
+    RTD_CHECK(RTD_Histogram_Init(&histogram, RTD_SENSOR_PT100, temperature_edges, TEST_BIN_COUNT, resistance_edges, counts) == 1U);
+
+    /* An edge belongs to the bin above it; the value just below it to the bin below */
+    for (edge = 0U; edge <= TEST_BIN_COUNT; edge++)
+    {
+        resistances[0] = resistance_edges[edge];
+        resistances[1] = nextafter(resistance_edges[edge], 0.0);
+        RTD_Histogram_Add(&histogram, resistances, 2U);
+    }
+
+    for (bin = 0U; bin < TEST_BIN_COUNT; bin++)
+    {
+        RTD_CHECK(counts[bin] == 2U);
+    }
+
+    RTD_CHECK( (histogram.underflow == 1U) && (histogram.overflow == 1U) );
+
+    /* Not-a-number counts as underflow */
+    resistances[0] = NAN;
+    RTD_Histogram_Add(&histogram, resistances, 1U);
+    RTD_CHECK(histogram.underflow == 2U);
+
+    /* Merge adds every counter of histograms with identical edges */
+    RTD_CHECK(RTD_Histogram_Init(&other, RTD_SENSOR_PT100, temperature_edges, TEST_BIN_COUNT, other_edges, other_counts) == 1U);
+    resistances[0] = RTD_CalculateResistance(RTD_SENSOR_PT100, 30.0);
+    resistances[1] = RTD_CalculateResistance(RTD_SENSOR_PT100, 500.0);
+    RTD_Histogram_Add(&other, resistances, 2U);
+
+    RTD_CHECK(RTD_Histogram_Merge(&histogram, &other) == 1U);
+    RTD_CHECK( (counts[3] == 3U) && (counts[4] == 2U) && (histogram.overflow == 2U) && (histogram.underflow == 2U) );
+
+    /* Histograms of another sensor type have other resistance edges */
+    RTD_CHECK(RTD_Histogram_Init(&other, RTD_SENSOR_PT1000, temperature_edges, TEST_BIN_COUNT, other_edges, other_counts) == 1U);
+    RTD_CHECK(RTD_Histogram_Merge(&histogram, &other) == 0U);
+
+    RTD_Histogram_Reset(&histogram);
+    RTD_CHECK( (counts[3] == 0U) && (histogram.underflow == 0U) && (histogram.overflow == 0U) );
+}
+
+/**
+ * @brief Statistics of a code histogram against a pass over the expanded samples.
+ */
+static void TestCodeHistogram(void)
+{
+    uint32_t code = 0U, first_code = TEST_CODE_COUNT;
+    uint64_t count = 0U, failed = 0U, cumulative = 0U, rank = 0U;
+    double resistance = 0.0, sum = 0.0, squares = 0.0, mean = 0.0;
+    double temperatures[TEST_CODE_COUNT];
+    double percentile_temperatures[4];
+    uint64_t code_counts[TEST_CODE_COUNT];
+    const double percentiles[4] = {0.0, 50.0, 100.0, 101.0};
+    const RTD_AdcDescriptor_t adc = {RTD_SENSOR_PT100, 15.0, 0.5};
+    RTD_TemperatureStats_t stats;
+
+    /* Codes 0 to 6 lie below -200°C */
+    for (code = 0U; code < TEST_CODE_COUNT; code++)
+    {
+        code_counts[code] = ((code * 7U) + 3U) % 5U;
+        resistance = adc.resistance_offset + ((double)code * adc.resistance_per_code);
+        temperatures[code] = RTD_CalculateTemperature(RTD_SENSOR_PT100, resistance, -150.0);
+
+        if (temperatures[code] == RTD_CONVERSION_FAILED)
+        {
+            failed += code_counts[code];
+        }
+        else
+        {
+            first_code = ( (first_code == TEST_CODE_COUNT) && (code_counts[code] != 0U) ) ? code : first_code;
+            count += code_counts[code];
+            sum += (double)code_counts[code] * temperatures[code];
+        }
+    }
+
+    mean = sum / (double)count;
+
+    for (code = 0U; code < TEST_CODE_COUNT; code++)
+    {
+        if (temperatures[code] != RTD_CONVERSION_FAILED)
+        {
+            squares += (double)code_counts[code] * (temperatures[code] - mean) * (temperatures[code] - mean);
+        }
+    }
+
+    RTD_CHECK(RTD_Stats_FromCodeHistogram(&adc, code_counts, TEST_CODE_COUNT, percentiles, percentile_temperatures, 4U, &stats) == 1U);
+    RTD_CHECK( (failed != 0U) && (stats.failed_count == failed) && (stats.sample_count == count) );
+    RTD_CHECK_NEAR(stats.mean, mean, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(stats.std_deviation, sqrt(squares / (double)count), TEST_TOLERANCE);
+    RTD_CHECK_NEAR(stats.min, temperatures[first_code], TEST_TOLERANCE);
+    RTD_CHECK_NEAR(stats.max, temperatures[TEST_CODE_COUNT - 1U], TEST_TOLERANCE);
+
+    /* Nearest rank: the 50th percentile is the code holding sample ceil(count / 2) */
+    rank = (count + 1U) / 2U;
+    for (code = first_code; cumulative < rank; code++)
+    {
+        cumulative += code_counts[code];
+    }
+
+    RTD_CHECK_NEAR(percentile_temperatures[0], stats.min, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(percentile_temperatures[1], temperatures[code - 1U], TEST_TOLERANCE);
+    RTD_CHECK_NEAR(percentile_temperatures[2], stats.max, TEST_TOLERANCE);
+    RTD_CHECK(percentile_temperatures[3] == RTD_CONVERSION_FAILED);
+
+    /* Only out-of-range samples: no statistics */
+    for (code = 0U; code < TEST_CODE_COUNT; code++)
+    {
+        code_counts[code] = (temperatures[code] == RTD_CONVERSION_FAILED) ? 1U : 0U;
+    }
+
+    RTD_CHECK(RTD_Stats_FromCodeHistogram(&adc, code_counts, TEST_CODE_COUNT, NULL, NULL, 0U, &stats) == 0U);
+    RTD_CHECK( (stats.sample_count == 0U) && (stats.failed_count == 7U) && (stats.mean == RTD_CONVERSION_FAILED) );
+}
+
+/**
+ * @brief Temperature of a rollup channel at a timestamp; channel 1 fails every 7th frame.
+ */
+static double RollupTemperature(uint64_t timestamp, uint32_t channel)
+{
+    double temperature = 20.0 + (0.37 * (double)((timestamp * 13U) % 17U));
+
+    if (channel != 0U)
+    {
+        temperature = ((timestamp % 7U) == 0U) ? RTD_CONVERSION_FAILED : (50.0 - (0.1 * (double)timestamp));
+    }
+
+    return temperature;
+}
+
+/**
+ * @brief Checks a rollup record against a single Welford pass over the frames of its window.
+ */
+static void CheckRecord(const RTD_RollupRecord_t *record)
+{
+    uint64_t timestamp = 0U, count = 0U, failed = 0U;
+    double temperature = 0.0, delta = 0.0, mean = 0.0, m2 = 0.0, min = HUGE_VAL, max = -HUGE_VAL;
+
+    for (timestamp = record->start; timestamp < (record->start + rollup_periods[record->level]); timestamp++)
+    {
+        if ( (timestamp >= TEST_FIRST_TIME) && (timestamp < (TEST_FIRST_TIME + TEST_FRAME_COUNT)) )
+        {
+            temperature = RollupTemperature(timestamp, record->channel);
+
+            if (temperature == RTD_CONVERSION_FAILED)
+            {
+                failed++;
+            }
+            else
+            {
+                count++;
+                delta = temperature - mean;
+                mean += delta / (double)count;
+                m2 += delta * (temperature - mean);
+                min = (temperature < min) ? temperature : min;
+                max = (temperature > max) ? temperature : max;
+            }
+        }
+    }
+
+    RTD_CHECK( (record->stats.sample_count == count) && (record->stats.failed_count == failed) );
+    RTD_CHECK_NEAR(record->stats.mean, mean, TEST_TOLERANCE);
+    RTD_CHECK_NEAR(record->stats.std_deviation, sqrt(m2 / (double)count), TEST_TOLERANCE);
+    RTD_CHECK( (record->stats.min == min) && (record->stats.max == max) );
+}
+
+/**
+ * @brief Windows of both levels, the longer ones merged from the shorter, against direct passes.
+ */
+static void TestRollup(void)
+{
+    uint32_t frame = 0U, record = 0U, appended = 0U, channel = 0U;
+    uint32_t level_records[TEST_LEVEL_COUNT] = {0U, 0U};
+    double count[TEST_LEVEL_COUNT * TEST_CHANNELS];
+    double failed[TEST_LEVEL_COUNT * TEST_CHANNELS];
+    double mean[TEST_LEVEL_COUNT * TEST_CHANNELS];
+    double m2[TEST_LEVEL_COUNT * TEST_CHANNELS];
+    double min[TEST_LEVEL_COUNT * TEST_CHANNELS];
+    double max[TEST_LEVEL_COUNT * TEST_CHANNELS];
+    double temperatures[TEST_CHANNELS];
+    const uint64_t unnested[TEST_LEVEL_COUNT] = {10U, 25U};
+    RTD_RollupRecord_t records[TEST_RECORDS];
+    RTD_Rollup_t rollup;
+
+    RTD_CHECK(RTD_Rollup_Init(&rollup, count, failed, mean, m2, min, max, TEST_CHANNELS, unnested, TEST_LEVEL_COUNT,
+                              records, TEST_RECORDS) == 0U);
+    RTD_CHECK(RTD_Rollup_Init(&rollup, count, failed, mean, m2, min, max, TEST_CHANNELS, rollup_periods, TEST_LEVEL_COUNT,
+                              records, TEST_RECORDS) == 1U);
+
+    /* The flush after the last frame closes the open windows of both levels */
+    for (frame = 0U; frame <= TEST_FRAME_COUNT; frame++)
+    {
+        if (frame < TEST_FRAME_COUNT)
+        {
+            for (channel = 0U; channel < TEST_CHANNELS; channel++)
+            {
+                temperatures[channel] = RollupTemperature(TEST_FIRST_TIME + frame, channel);
+            }
+
+            appended = RTD_Rollup_AddFrame(&rollup, TEST_FIRST_TIME + frame, temperatures);
+        }
+        else
+        {
+            appended = RTD_Rollup_Flush(&rollup);
+        }
+
+        RTD_CHECK(appended == rollup.record_count);
+
+        for (record = 0U; record < rollup.record_count; record++)
+        {
+            CheckRecord(&records[record]);
+            level_records[records[record].level]++;
+        }
+
+        RTD_Rollup_ClearRecords(&rollup);
+    }
+
+    /* Level 0: windows 100 to 170; level 1: windows 80, 120 and 160 */
+    RTD_CHECK( (level_records[0] == (8U * TEST_CHANNELS)) && (level_records[1] == (3U * TEST_CHANNELS)) );
+    RTD_CHECK(rollup.dropped == 0U);
+}
+
+
+int main(void)
+{
+    TestHistogram();
+    TestCodeHistogram();
+    TestRollup();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_stats.c */
@@ -0,0 +1,273 @@
+/**
+ * @file    test_stream.c
+ * @author  Amirhossein Askari
+ * @version v1.0.0
+ * @date    2026-10-17
+ * @email   theamiraskarii@gmail.com
+ * @see     https://github.com/AmirhoseinAskari
+ * @brief   Checks the sample rings, the streaming conversion pipeline, the latest-value table
+ *          and the conversion cache.
+ */
+
+
+/* ------------------------------------- Includes ------------------------------------- */
+
+#include "rtd_test.h"                 ///< Check macros
+#include "platinum_rtd_stream.h"      ///< Functions under test
+
+
+/* ------------------------------------- Defines -------------------------------------- */
+
+#define  TEST_RING_CAPACITY  8U        /**< Slots of each ring                     */
+#define  TEST_CHANNEL_COUNT  2U        /**< Channels of the pipeline               */
+#define  TEST_ENTRY_COUNT    16U       /**< Direct-mapped entries of the cache     */
+#define  TEST_TOLERANCE      1.0e-9    /**< Accepted conversion difference (K)     */
+
+
+/* ------------------------------------- Variables ------------------------------------ */
+
+RTD_TEST_MAIN;
+
+static _Alignas(RTD_CACHE_LINE_SIZE) RTD_LatestSlot_t latest_slots[TEST_CHANNEL_COUNT];
+
+
+/* ------------------------------------- Functions ------------------------------------ */
+
+/**
+ * @brief Fills raw samples numbered from @p first, alternating between the two channels.
+ */
+static void FillSamples(RTD_Sample_t *samples, uint32_t first, uint32_t count)
+{
+    uint32_t index = 0U;
+
+    for (index = 0U; index < count; index++)
+    {
+        samples[index].timestamp = first + index;
+        samples[index].channel = (first + index) % TEST_CHANNEL_COUNT;
+        samples[index].status = RTD_SAMPLE_OK;
+        samples[index].value = 100.0 + (double)(first + index);
+    }
+}
+
+/**
+ * @brief Wraparound of the ring indices and backpressure of a full ring.
+ */
+static void TestRing(void)
+{
+    uint32_t index = 0U;
+    RTD_Sample_t buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t samples[TEST_RING_CAPACITY + 2U];
+    RTD_Ring_t ring;
+
+    RTD_CHECK(RTD_Ring_Init(&ring, buffer, 6U) == 0U);
+    RTD_CHECK(RTD_Ring_Init(&ring, buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK( (RTD_Ring_GetCount(&ring) == 0U) && (RTD_Ring_GetSpace(&ring) == TEST_RING_CAPACITY) );
+
+    FillSamples(samples, 0U, 5U);
+    RTD_CHECK(RTD_Ring_Push(&ring, samples, 5U) == 5U);
+    RTD_CHECK(RTD_Ring_Pop(&ring, samples, 3U) == 3U);
+    RTD_CHECK( (samples[0].timestamp == 0U) && (samples[2].timestamp == 2U) );
+
+    /* The second push wraps around the end of the buffer and stops when the ring is full */
+    FillSamples(samples, 5U, TEST_RING_CAPACITY);
+    RTD_CHECK(RTD_Ring_Push(&ring, samples, TEST_RING_CAPACITY) == 6U);
+    RTD_CHECK( (RTD_Ring_GetCount(&ring) == TEST_RING_CAPACITY) && (RTD_Ring_GetSpace(&ring) == 0U) );
+    RTD_CHECK(RTD_Ring_Push(&ring, samples, 1U) == 0U);
+
+    RTD_CHECK(RTD_Ring_Pop(&ring, samples, TEST_RING_CAPACITY + 2U) == TEST_RING_CAPACITY);
+    for (index = 0U; index < TEST_RING_CAPACITY; index++)
+    {
+        RTD_CHECK(samples[index].timestamp == (3U + index));
+        RTD_CHECK(samples[index].value == (103.0 + (double)index));
+    }
+
+    RTD_CHECK(RTD_Ring_Pop(&ring, samples, 1U) == 0U);
+}
+
+/**
+ * @brief Conversion through the pipeline, unknown channels and a full output ring.
+ */
+static void TestPipeline(void)
+{
+    uint32_t index = 0U;
+    uint8_t channel_descriptors[TEST_CHANNEL_COUNT];
+    RTD_Sample_t input_buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t output_buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t samples[TEST_RING_CAPACITY];
+    RTD_Ring_t input;
+    RTD_Ring_t output;
+    RTD_DescriptorTable_t table;
+    RTD_Pipeline_t pipeline;
+
+    RTD_InitDescriptorTable(&table);
+    channel_descriptors[0] = RTD_AddDescriptor(&table, RTD_SENSOR_PT100);
+    channel_descriptors[1] = RTD_AddDescriptor(&table, RTD_SENSOR_PT1000);
+    RTD_CHECK(RTD_Ring_Init(&input, input_buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK(RTD_Ring_Init(&output, output_buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK(RTD_Pipeline_Init(&pipeline, &input, &output, &table, channel_descriptors, TEST_CHANNEL_COUNT) == 1U);
+
+    /* Sample 5 belongs to an unknown channel */
+    FillSamples(samples, 0U, 6U);
+    samples[5].channel = TEST_CHANNEL_COUNT;
+    RTD_CHECK(RTD_Ring_Push(&input, samples, 6U) == 6U);
+    RTD_CHECK(RTD_Pipeline_Process(&pipeline, 4U) == 4U);
+    RTD_CHECK(RTD_Ring_GetCount(&input) == 2U);
+    RTD_CHECK(RTD_Pipeline_Process(&pipeline, TEST_RING_CAPACITY) == 2U);
+    RTD_CHECK(RTD_Ring_Pop(&output, samples, TEST_RING_CAPACITY) == 6U);
+
+    for (index = 0U; index < 5U; index++)
+    {
+        RTD_CHECK( (samples[index].timestamp == index) && (samples[index].channel == (index % TEST_CHANNEL_COUNT)) );
+    }
+
+    /* PT1000 resistances near 100 ohms are out of range */
+    RTD_CHECK(samples[0].status == RTD_SAMPLE_OK);
+    RTD_CHECK_NEAR(samples[0].value, RTD_CalculateTemperature(RTD_SENSOR_PT100, 100.0, 25.0), TEST_TOLERANCE);
+    RTD_CHECK_NEAR(samples[4].value, RTD_CalculateTemperature(RTD_SENSOR_PT100, 104.0, 25.0), TEST_TOLERANCE);
+    RTD_CHECK( (samples[1].status == RTD_SAMPLE_CONVERSION_FAILED) && (samples[1].value == RTD_CONVERSION_FAILED) );
+    RTD_CHECK( (samples[5].status == RTD_SAMPLE_CONVERSION_FAILED) && (samples[5].channel == TEST_CHANNEL_COUNT) );
+    RTD_CHECK( (pipeline.samples_processed == 6U) && (pipeline.samples_failed == 3U) );
+
+    /* Only as many samples as the output ring accepts are taken from the input */
+    FillSamples(samples, 0U, TEST_RING_CAPACITY);
+    RTD_CHECK(RTD_Ring_Push(&output, samples, 5U) == 5U);
+    RTD_CHECK(RTD_Ring_Push(&input, samples, TEST_RING_CAPACITY) == TEST_RING_CAPACITY);
+    RTD_CHECK(RTD_Pipeline_Process(&pipeline, TEST_RING_CAPACITY) == 3U);
+    RTD_CHECK( (RTD_Ring_GetCount(&input) == 5U) && (RTD_Ring_GetSpace(&output) == 0U) );
+}
+
+/**
+ * @brief Latest-value round trip through the pipeline and a read during an update.
+ */
+static void TestLatest(void)
+{
+    uint8_t channel_descriptors[TEST_CHANNEL_COUNT];
+    RTD_Sample_t input_buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t output_buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t samples[TEST_RING_CAPACITY];
+    RTD_Sample_t sample;
+    RTD_Ring_t input;
+    RTD_Ring_t output;
+    RTD_DescriptorTable_t table;
+    RTD_LatestTable_t latest;
+    RTD_Pipeline_t pipeline;
+
+    RTD_InitDescriptorTable(&table);
+    channel_descriptors[0] = RTD_AddDescriptor(&table, RTD_SENSOR_PT100);
+    channel_descriptors[1] = RTD_AddDescriptor(&table, RTD_SENSOR_PT100);
+    RTD_CHECK(RTD_Ring_Init(&input, input_buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK(RTD_Ring_Init(&output, output_buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK(RTD_Pipeline_Init(&pipeline, &input, &output, &table, channel_descriptors, TEST_CHANNEL_COUNT) == 1U);
+    RTD_CHECK(RTD_Latest_Init(&latest, latest_slots, TEST_CHANNEL_COUNT) == 1U);
+    RTD_Pipeline_AttachLatest(&pipeline, &latest);
+
+    RTD_CHECK(RTD_Latest_Read(&latest, 1U, &sample) == 1U);
+    RTD_CHECK( (sample.status == RTD_SAMPLE_NO_DATA) && (sample.value == RTD_CONVERSION_FAILED) );
+    RTD_CHECK(RTD_Latest_Read(&latest, TEST_CHANNEL_COUNT, &sample) == 0U);
+
+    /* Samples 0 to 4: the table keeps the last one of each channel */
+    FillSamples(samples, 0U, 5U);
+    RTD_CHECK(RTD_Ring_Push(&input, samples, 5U) == 5U);
+    RTD_CHECK(RTD_Pipeline_Process(&pipeline, 5U) == 5U);
+    RTD_CHECK(RTD_Ring_Pop(&output, samples, 5U) == 5U);
+
+    RTD_CHECK(RTD_Latest_Read(&latest, 0U, &sample) == 1U);
+    RTD_CHECK( (sample.channel == 0U) && (sample.timestamp == 4U) && (sample.status == RTD_SAMPLE_OK) );
+    RTD_CHECK(sample.value == samples[4].value);
+    RTD_CHECK(RTD_Latest_Read(&latest, 1U, &sample) == 1U);
+    RTD_CHECK( (sample.timestamp == 3U) && (sample.value == samples[3].value) );
+
+    /* Direct updates ignore unknown channels and store the status */
+    samples[0].channel = TEST_CHANNEL_COUNT;
+    samples[1].status = RTD_SAMPLE_CONVERSION_FAILED;
+    samples[1].value = RTD_CONVERSION_FAILED;
+    RTD_Latest_Update(&latest, samples, 2U);
+    RTD_CHECK(RTD_Latest_Read(&latest, 1U, &sample) == 1U);
+    RTD_CHECK( (sample.timestamp == 1U) && (sample.status == RTD_SAMPLE_CONVERSION_FAILED) );
+
+    /* An odd sequence marks a slot being written; the read is rejected */
+    latest_slots[0].sequence = latest_slots[0].sequence + 1U;
+    RTD_CHECK(RTD_Latest_Read(&latest, 0U, &sample) == 0U);
+}
+
+/**
+ * @brief Runs one frame of both channels through a pipeline and returns the output.
+ */
+static void ProcessFrame(RTD_Pipeline_t *pipeline, double first, double second, RTD_Sample_t *samples)
+{
+    FillSamples(samples, 0U, TEST_CHANNEL_COUNT);
+    samples[0].value = first;
+    samples[1].value = second;
+    RTD_CHECK(RTD_Ring_Push(pipeline->input, samples, TEST_CHANNEL_COUNT) == TEST_CHANNEL_COUNT);
+    RTD_CHECK(RTD_Pipeline_Process(pipeline, TEST_CHANNEL_COUNT) == TEST_CHANNEL_COUNT);
+    RTD_CHECK(RTD_Ring_Pop(pipeline->output, samples, TEST_CHANNEL_COUNT) == TEST_CHANNEL_COUNT);
+}
+
+/**
+ * @brief Hits of both cache layers return the directly converted temperature.
+ */
+static void TestCache(void)
+{
+    uint8_t channel_descriptors[TEST_CHANNEL_COUNT];
+    uint8_t entry_descriptor[TEST_ENTRY_COUNT];
+    double last_resistance[TEST_CHANNEL_COUNT];
+    double last_temperature[TEST_CHANNEL_COUNT];
+    double entry_resistance[TEST_ENTRY_COUNT];
+    double entry_temperature[TEST_ENTRY_COUNT];
+    RTD_Sample_t input_buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t output_buffer[TEST_RING_CAPACITY];
+    RTD_Sample_t samples[TEST_CHANNEL_COUNT];
+    RTD_Sample_t missed[TEST_CHANNEL_COUNT];
+    RTD_Ring_t input;
+    RTD_Ring_t output;
+    RTD_DescriptorTable_t table;
+    RTD_ConversionCache_t cache;
+    RTD_Pipeline_t pipeline;
+
+    RTD_InitDescriptorTable(&table);
+    channel_descriptors[0] = RTD_AddDescriptor(&table, RTD_SENSOR_PT100);
+    channel_descriptors[1] = channel_descriptors[0];
+    RTD_CHECK(RTD_Ring_Init(&input, input_buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK(RTD_Ring_Init(&output, output_buffer, TEST_RING_CAPACITY) == 1U);
+    RTD_CHECK(RTD_Pipeline_Init(&pipeline, &input, &output, &table, channel_descriptors, TEST_CHANNEL_COUNT) == 1U);
+    RTD_CHECK(RTD_Cache_Init(&cache, last_resistance, last_temperature, TEST_CHANNEL_COUNT, entry_resistance, entry_temperature,
+                             entry_descriptor, 12U) == 0U);
+    RTD_CHECK(RTD_Cache_Init(&cache, last_resistance, last_temperature, TEST_CHANNEL_COUNT, entry_resistance, entry_temperature,
+                             entry_descriptor, TEST_ENTRY_COUNT) == 1U);
+    RTD_CHECK(RTD_Cache_GetHitRate(&cache) == 0.0);
+    RTD_Pipeline_AttachCache(&pipeline, &cache);
+
+    /* Both samples are converted and stored in both layers */
+    ProcessFrame(&pipeline, 110.0, 5.0, missed);
+    RTD_CHECK( (cache.misses == 2U) && (cache.channel_hits == 0U) && (cache.entry_hits == 0U) );
+    RTD_CHECK_NEAR(missed[0].value, RTD_CalculateTemperature(RTD_SENSOR_PT100, 110.0, 25.0), TEST_TOLERANCE);
+    RTD_CHECK( (missed[1].status == RTD_SAMPLE_CONVERSION_FAILED) && (missed[1].value == RTD_CONVERSION_FAILED) );
+
+    /* Channel 0 repeats its resistance; channel 1 takes the entry stored by channel 0 */
+    ProcessFrame(&pipeline, 110.0, 110.0, samples);
+    RTD_CHECK( (cache.misses == 2U) && (cache.channel_hits == 1U) && (cache.entry_hits == 1U) );
+    RTD_CHECK( (samples[0].value == missed[0].value) && (samples[1].value == missed[0].value) );
+    RTD_CHECK( (samples[0].status == RTD_SAMPLE_OK) && (samples[1].status == RTD_SAMPLE_OK) );
+
+    /* A cached failure is still published as a failure */
+    ProcessFrame(&pipeline, 5.0, 110.0, samples);
+    ProcessFrame(&pipeline, 5.0, 110.0, samples);
+    RTD_CHECK( (samples[0].status == RTD_SAMPLE_CONVERSION_FAILED) && (samples[0].value == RTD_CONVERSION_FAILED) );
+    RTD_CHECK(samples[1].value == missed[0].value);
+    RTD_CHECK( (cache.misses == 2U) && (cache.channel_hits == 4U) && (cache.entry_hits == 2U) );
+    RTD_CHECK_NEAR(RTD_Cache_GetHitRate(&cache), 0.75, TEST_TOLERANCE);
+}
+
+
+int main(void)
+{
+    TestRing();
+    TestPipeline();
+    TestLatest();
+    TestCache();
+
+    return RTD_TEST_RESULT();
+}
+
+
+/* test_stream.c */